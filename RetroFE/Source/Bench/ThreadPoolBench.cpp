@@ -0,0 +1,107 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Cost of queueing a small task and waiting for it, per task, through each way the pool
+// offers: enqueue with a future per task, submit, a TaskGroup and parallelFor.
+//   bench-threadpool [tasks] [rounds]
+
+#include "../Graphics/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+// Stands in for a component update: a little work on data the task captured
+void work(std::atomic<size_t>& sum, size_t i)
+{
+    size_t x = i;
+    for (int k = 0; k < 64; k++)
+        x = x * 2654435761u + k;
+    sum.fetch_add(x & 1, std::memory_order_relaxed);
+}
+
+// Nanoseconds per task (minimum and median over rounds) for queueing tasks and waiting
+template <typename Round>
+void run(const char* name, int rounds, size_t tasks, Round round)
+{
+    std::vector<double> times;
+    for (int r = 0; r < rounds; r++) {
+        auto begin = std::chrono::steady_clock::now();
+        round(tasks);
+        auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(tasks));
+    }
+    std::sort(times.begin(), times.end());
+    std::printf("  %-12s min %8.1fns  median %8.1fns per task\n", name, times.front(), times[times.size() / 2]);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    size_t tasks = argc > 1 ? static_cast<size_t>(std::atol(argv[1])) : 1000;
+    int rounds   = argc > 2 ? std::atoi(argv[2]) : 200;
+    if (tasks == 0 || rounds <= 0) {
+        std::fprintf(stderr, "usage: %s [tasks] [rounds]\n", argv[0]);
+        return 1;
+    }
+
+    ThreadPool& pool = ThreadPool::instance();
+    std::atomic<size_t> sum(0);
+    std::printf("%zu tasks per round, %zu workers:\n", tasks, pool.size());
+
+    run("enqueue", rounds, tasks, [&](size_t count) {
+        std::vector<std::future<void>> futures;
+        futures.reserve(count);
+        for (size_t i = 0; i < count; i++)
+            futures.push_back(pool.enqueue([&sum, i] { work(sum, i); }));
+        for (std::future<void>& future : futures)
+            future.get();
+    });
+
+    run("submit", rounds, tasks, [&](size_t count) {
+        std::atomic<size_t> finished(0);
+        for (size_t i = 0; i < count; i++) {
+            pool.submit([&sum, &finished, i] {
+                work(sum, i);
+                finished.fetch_add(1, std::memory_order_release);
+            });
+        }
+        while (finished.load(std::memory_order_acquire) < count)
+            std::this_thread::yield();
+    });
+
+    run("TaskGroup", rounds, tasks, [&](size_t count) {
+        TaskGroup group(pool);
+        for (size_t i = 0; i < count; i++)
+            group.run([&sum, i] { work(sum, i); });
+        group.wait();
+    });
+
+    run("parallelFor", rounds, tasks, [&](size_t count) {
+        pool.parallelFor(0, count, [&sum](size_t i) { work(sum, i); });
+    });
+
+    std::printf("  (checksum %zu)\n", sum.load());
+    return 0;
+}
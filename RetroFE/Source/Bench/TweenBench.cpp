@@ -0,0 +1,136 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+// Compares TweenSet::apply with evaluating the same tweens one Tween::apply at a time,
+// for a page of scroll sets (all linear) and for sets mixing every easing.
+//   bench-tweens [sets] [frames]
+
+#include "../Graphics/Animate/Tween.h"
+#include "../Graphics/Animate/TweenSet.h"
+#include "../Graphics/ViewInfo.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+// The float properties a ScrollingList item tweens on every scroll
+const TweenProperty properties[] = {
+    TWEEN_PROPERTY_HEIGHT, TWEEN_PROPERTY_WIDTH, TWEEN_PROPERTY_ANGLE, TWEEN_PROPERTY_ALPHA,
+    TWEEN_PROPERTY_X, TWEEN_PROPERTY_Y, TWEEN_PROPERTY_X_ORIGIN, TWEEN_PROPERTY_Y_ORIGIN,
+    TWEEN_PROPERTY_X_OFFSET, TWEEN_PROPERTY_Y_OFFSET, TWEEN_PROPERTY_FONT_SIZE,
+    TWEEN_PROPERTY_BACKGROUND_ALPHA, TWEEN_PROPERTY_MAX_WIDTH, TWEEN_PROPERTY_MAX_HEIGHT,
+    TWEEN_PROPERTY_CONTAINER_X, TWEEN_PROPERTY_CONTAINER_Y, TWEEN_PROPERTY_CONTAINER_WIDTH,
+    TWEEN_PROPERTY_CONTAINER_HEIGHT
+};
+const int propertyCount = sizeof(properties) / sizeof(properties[0]);
+const int algorithmCount = EASE_INOUT_CIRCULAR + 1;
+const double duration = 0.25;
+
+std::vector<TweenSet> makeSets(int count, bool mixed)
+{
+    std::vector<TweenSet> sets(count);
+    for (int s = 0; s < count; s++) {
+        for (int p = 0; p < propertyCount; p++) {
+            TweenAlgorithm algorithm = mixed ? static_cast<TweenAlgorithm>((s + p) % algorithmCount) : LINEAR;
+            double from = s * 10 + p;
+            sets[s].push(std::make_unique<Tween>(properties[p], algorithm, from, from + 100 + p, duration));
+        }
+    }
+    return sets;
+}
+
+bool applyEach(const TweenSet& set, ViewInfo& info, const ViewInfo& start, double elapsed)
+{
+    bool done = true;
+    for (unsigned int i = 0; i < set.size(); i++) {
+        Tween const* tween = set.getTween(i);
+        if (elapsed < tween->duration)
+            done = false;
+        tween->apply(info, start, std::min(elapsed, tween->duration));
+    }
+    return done;
+}
+
+float checksum(const ViewInfo& info)
+{
+    return info.X + info.Y + info.Width + info.Height + info.Alpha + info.Angle + info.FontSize + info.MaxWidth;
+}
+
+// Microseconds per frame (minimum and median over frames) with one apply per set and frame
+template <typename Apply>
+void run(const char* name, const std::vector<TweenSet>& sets, int frames, Apply apply, std::vector<float>& results)
+{
+    std::vector<ViewInfo> infos(sets.size());
+    ViewInfo start;
+    std::vector<double> times;
+    float sink = 0;
+    results.clear();
+    for (int f = 0; f < frames; f++) {
+        double elapsed = duration * 1.2 * f / frames;
+        auto begin = std::chrono::steady_clock::now();
+        for (size_t s = 0; s < sets.size(); s++) {
+            apply(sets[s], infos[s], start, elapsed);
+        }
+        auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+        for (ViewInfo const& info : infos) {
+            results.push_back(checksum(info));
+            sink += results.back();
+        }
+    }
+    std::sort(times.begin(), times.end());
+    std::printf("  %-10s min %8.2fus  median %8.2fus  (checksum %g)\n", name, times.front(), times[times.size() / 2], sink);
+}
+
+void compare(const char* name, const std::vector<TweenSet>& sets, int frames)
+{
+    std::vector<float> batched;
+    std::vector<float> single;
+    std::printf("%s, %zu sets of %d tweens:\n", name, sets.size(), propertyCount);
+    run("TweenSet", sets, frames, [](const TweenSet& set, ViewInfo& info, const ViewInfo& start, double elapsed) {
+        return set.apply(info, start, elapsed, -1);
+    }, batched);
+    run("per-Tween", sets, frames, applyEach, single);
+
+    double worst = 0;
+    for (size_t i = 0; i < batched.size(); i++) {
+        double scale = std::max(1.0, std::fabs(static_cast<double>(single[i])));
+        worst = std::max(worst, std::fabs(static_cast<double>(batched[i]) - single[i]) / scale);
+    }
+    std::printf("  largest relative difference %g\n", worst);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int sets   = argc > 1 ? std::atoi(argv[1]) : 300;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 1000;
+    if (sets <= 0 || frames <= 0) {
+        std::fprintf(stderr, "usage: %s [sets] [frames]\n", argv[0]);
+        return 1;
+    }
+
+    compare("Scroll sets (linear)", makeSets(sets, false), frames);
+    compare("Mixed easing", makeSets(sets, true), frames);
+    return 0;
+}
@@ -0,0 +1,177 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "InputRecorder.h"
+#include "../Utility/Log.h"
+#include <iomanip>
+#include <sstream>
+
+InputRecorder::InputRecorder()
+    : mode_(ModeOff)
+    , frame_(0)
+    , time_(0)
+    , dt_(0)
+{
+    for (bool &pressed : state_) {
+        pressed = false;
+    }
+}
+
+InputRecorder::~InputRecorder()
+{
+    close();
+}
+
+bool InputRecorder::record(const std::string &file, unsigned int seed)
+{
+    out_.open(file.c_str());
+    if (!out_.is_open()) {
+        LOG_ERROR("InputRecorder", "Could not create " + file);
+        return false;
+    }
+    out_ << "seed " << seed << "\n";
+    out_ << std::fixed << std::setprecision(9);
+    file_ = file;
+    mode_ = ModeRecord;
+    LOG_INFO("InputRecorder", "Recording input to " + file);
+    return true;
+}
+
+bool InputRecorder::replay(const std::string &file, unsigned int &seed)
+{
+    in_.open(file.c_str());
+    std::string keyword;
+    if (!in_.is_open() || !(in_ >> keyword >> seed) || keyword != "seed") {
+        LOG_ERROR("InputRecorder", "Could not read a recording from " + file);
+        in_.close();
+        return false;
+    }
+    file_ = file;
+    mode_ = ModeReplay;
+    LOG_INFO("InputRecorder", "Replaying input from " + file + " with seed " + std::to_string(seed));
+    return true;
+}
+
+bool InputRecorder::isRecording() const
+{
+    return mode_ == ModeRecord;
+}
+
+bool InputRecorder::isReplaying() const
+{
+    return mode_ == ModeReplay;
+}
+
+bool InputRecorder::beginFrame(double &time, double &dt)
+{
+    if (mode_ == ModeRecord) {
+        time_ = time;
+        dt_   = dt;
+        return true;
+    }
+    if (mode_ != ModeReplay) {
+        return true;
+    }
+
+    if (!readFrame()) {
+        return false;
+    }
+    trace_.push_back(static_cast<float>(dt * 1000));
+    time = time_;
+    dt   = dt_;
+    return true;
+}
+
+// Reads the next "<frame> <time> <dt> [+control|-control]" line into time_, dt_ and changes_
+bool InputRecorder::readFrame()
+{
+    std::string line;
+    changes_.clear();
+    while (std::getline(in_, line)) {
+        std::istringstream ss(line);
+        unsigned long frame;
+        if (!(ss >> frame >> time_ >> dt_)) {
+            continue;
+        }
+        if (frame != frame_) {
+            LOG_WARNING("InputRecorder", "Expected frame " + std::to_string(frame_) + " but read " + std::to_string(frame));
+        }
+        frame_ = frame + 1;
+
+        std::string change;
+        while (ss >> change) {
+            UserInput::KeyCode_E code;
+            if (change.size() < 2 || (change[0] != '+' && change[0] != '-') || !UserInput::keyCode(change.substr(1), code)) {
+                LOG_WARNING("InputRecorder", "Ignoring \"" + change + "\" in frame " + std::to_string(frame));
+                continue;
+            }
+            changes_.push_back(std::make_pair(code, change[0] == '+'));
+        }
+        return true;
+    }
+    return false;
+}
+
+void InputRecorder::syncInput(UserInput &input)
+{
+    if (mode_ == ModeRecord) {
+        out_ << frame_++ << " " << time_ << " " << dt_;
+        for (unsigned int i = UserInput::KeyCodeNull + 1; i < UserInput::KeyCodeMax; ++i) {
+            UserInput::KeyCode_E code = static_cast<UserInput::KeyCode_E>(i);
+            if (input.keystate(code) != state_[i]) {
+                state_[i] = input.keystate(code);
+                out_ << (state_[i] ? " +" : " -") << UserInput::keyName(code);
+            }
+        }
+        out_ << "\n";
+    }
+    else if (mode_ == ModeReplay) {
+        for (auto &change : changes_) {
+            state_[change.first] = change.second;
+        }
+        changes_.clear();
+        // Assert the whole recorded state; state resets in RetroFE drop injected keys
+        for (unsigned int i = UserInput::KeyCodeNull + 1; i < UserInput::KeyCodeMax; ++i) {
+            UserInput::KeyCode_E code = static_cast<UserInput::KeyCode_E>(i);
+            if (input.keystate(code) != state_[i]) {
+                input.setKeystate(code, state_[i]);
+            }
+        }
+    }
+}
+
+void InputRecorder::close()
+{
+    if (mode_ == ModeRecord) {
+        out_.close();
+        LOG_INFO("InputRecorder", "Recorded " + std::to_string(frame_) + " frames to " + file_);
+    }
+    else if (mode_ == ModeReplay) {
+        in_.close();
+        std::string traceFile = file_ + ".trace.csv";
+        std::ofstream trace(traceFile.c_str());
+        if (trace.is_open()) {
+            trace << "frame,ms\n";
+            for (size_t i = 0; i < trace_.size(); i++) {
+                trace << i << "," << trace_[i] << "\n";
+            }
+            LOG_INFO("InputRecorder", "Replayed " + std::to_string(frame_) + " frames, frame times written to " + traceFile);
+        }
+        else {
+            LOG_ERROR("InputRecorder", "Could not write " + traceFile);
+        }
+    }
+    mode_ = ModeOff;
+}
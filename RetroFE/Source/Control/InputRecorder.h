@@ -0,0 +1,71 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "UserInput.h"
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Records the mapped control transitions of a session together with the time and
+// delta time of every frame, and plays them back through UserInput. A replay feeds the
+// recorded times to the frame loop instead of the wall clock, so every build sees the
+// same input at the same frame and can be compared frame by frame. File format:
+//   seed <n>                                  random seed of the session
+//   <frame> <time> <dt> [+control|-control]   one line per frame
+class InputRecorder
+{
+public:
+    InputRecorder();
+    ~InputRecorder();
+
+    bool record(const std::string &file, unsigned int seed);
+    bool replay(const std::string &file, unsigned int &seed);
+    bool isRecording() const;
+    bool isReplaying() const;
+
+    // Called once the frame time is known. Replaying replaces time and dt with the
+    // recorded ones; returns false once the recording has run out.
+    bool beginFrame(double &time, double &dt);
+
+    // Called after input was read for the frame. Recording stores the transitions since
+    // the previous frame; replaying applies the recorded ones to input.
+    void syncInput(UserInput &input);
+
+    // Stops; a replay writes its wall clock frame times to <file>.trace.csv
+    void close();
+
+private:
+    enum Mode
+    {
+        ModeOff,
+        ModeRecord,
+        ModeReplay
+    };
+
+    bool readFrame();
+
+    Mode mode_;
+    std::string file_;
+    std::ofstream out_;
+    std::ifstream in_;
+    unsigned long frame_;
+    double time_;
+    double dt_;
+    bool state_[UserInput::KeyCodeMax];
+    std::vector<std::pair<UserInput::KeyCode_E, bool> > changes_;
+    std::vector<float> trace_;
+};
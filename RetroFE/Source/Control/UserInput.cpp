@@ -25,12 +25,71 @@
 #include "KeyboardHandler.h"
 #include "MouseButtonHandler.h"
 
+// Names used by scripts and recordings, in KeyCode_E order; controls.conf names where one exists
+static const char* keyCodeNames[UserInput::KeyCodeMax] = {
+    "null",
+    "up",
+    "down",
+    "left",
+    "right",
+    "playlistUp",
+    "playlistDown",
+    "playlistLeft",
+    "playlistRight",
+    "collectionUp",
+    "collectionDown",
+    "collectionLeft",
+    "collectionRight",
+    "select",
+    "back",
+    "pageDown",
+    "pageUp",
+    "letterDown",
+    "letterUp",
+    "favPlaylist",
+    "nextPlaylist",
+    "prevPlaylist",
+    "cyclePlaylist",
+    "nextCyclePlaylist",
+    "prevCyclePlaylist",
+    "random",
+    "menu",
+    "addPlaylist",
+    "removePlaylist",
+    "togglePlaylist",
+    "adminMode",
+    "hideItem",
+    "quit",
+    "reboot",
+    "saveFirstPlaylist",
+    "jbFastForward1m",
+    "jbFastRewind1m",
+    "jbFastForward5p",
+    "jbFastRewind5p",
+    "jbPause",
+    "jbRestart",
+    "kiosk",
+    "settingsCombo1",
+    "settingsCombo2",
+    "quitCombo1",
+    "quitCombo2",
+    "cycleCollection",
+    "prevCycleCollection",
+    "toggleGameInfo",
+    "toggleCollectionInfo",
+    "toggleBuildInfo",
+    "settings",
+    "toggleProfiler",
+    "dumpProfiler"
+};
+
 UserInput::UserInput(Configuration &c)
     : config_(c)
 {
     for(unsigned int i = 0; i < KeyCodeMax; ++i) {
         currentKeyState_[i] = false;
         lastKeyState_[i] = false;
+        injectedKeyState_[i] = false;
     }
     for ( unsigned int i = 0; i < cMaxJoy; i++ ) {
         joysticks_[i] = -1;
@@ -82,6 +141,8 @@ bool UserInput::initialize()
     MapKey("toggleCollectionInfo", KeyCodeToggleCollectionInfo, false);
     MapKey("toggleBuildInfo", KeyCodeToggleBuildInfo, false);
     MapKey("settings", KeyCodeSettings, false);
+    MapKey("toggleProfiler", KeyCodeToggleProfiler, false);
+    MapKey("dumpProfiler", KeyCodeDumpProfiler, false);
     
     std::string jbKey;
     if(config_.getProperty(OPTION_JUKEBOX, jbKey)) {
@@ -318,6 +379,13 @@ void UserInput::resetStates()
         currentKeyState_[keyHandlers_[i].second] = false;
         lastKeyState_[keyHandlers_[i].second] = false;
     }
+    for (unsigned int i = 0; i < KeyCodeMax; ++i) {
+        if (injectedKeyState_[i]) {
+            currentKeyState_[i] = false;
+            lastKeyState_[i] = false;
+            injectedKeyState_[i] = false;
+        }
+    }
 }
 
 
@@ -367,13 +435,16 @@ bool UserInput::update( SDL_Event &e )
         }
     }
 
-    for ( unsigned int i = 0; i < keyHandlers_.size( ); ++i ) {
+    for ( unsigned int i = 0; i < keyHandlers_.size( ) && !replaying_; ++i ) {
         InputHandler *h = keyHandlers_[i].first;
         if ( h ) {
             if ( h->update( e ) ) updated_ = true;
             currentKeyState_[keyHandlers_[i].second] |= h->pressed( );
         }
     }
+    for ( unsigned int i = 0; i < KeyCodeMax; ++i ) {
+        currentKeyState_[i] |= injectedKeyState_[i];
+    }
     
     return updated_;
 }
@@ -384,6 +455,14 @@ bool UserInput::keystate(KeyCode_E code) const
     return currentKeyState_[code];
 }
 
+bool UserInput::anyKeyPressed() const
+{
+    for (unsigned int i = 0; i < KeyCodeMax; ++i) {
+        if (currentKeyState_[i]) return true;
+    }
+    return false;
+}
+
 bool UserInput::lastKeyPressed(KeyCode_E code) const
 {
     if (lastKeyState_[code]) {
@@ -422,11 +501,42 @@ void UserInput::reconfigure()
 
 void UserInput::updateKeystate( )
 {
-    for ( unsigned int i = 0; i < keyHandlers_.size( ); ++i ) {
+    for ( unsigned int i = 0; i < keyHandlers_.size( ) && !replaying_; ++i ) {
         InputHandler *h = keyHandlers_[i].first;
         if ( h ) {
 			h->updateKeystate( );
             currentKeyState_[keyHandlers_[i].second] |= h->pressed( );
         }
     }
+    for ( unsigned int i = 0; i < KeyCodeMax; ++i ) {
+        currentKeyState_[i] |= injectedKeyState_[i];
+    }
+}
+
+bool UserInput::keyCode( const std::string& name, KeyCode_E& code )
+{
+    for ( unsigned int i = KeyCodeNull + 1; i < KeyCodeMax; ++i ) {
+        if ( name == keyCodeNames[i] ) {
+            code = static_cast<KeyCode_E>( i );
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* UserInput::keyName( KeyCode_E code )
+{
+    return keyCodeNames[code];
+}
+
+void UserInput::setKeystate( KeyCode_E code, bool pressed )
+{
+    lastKeyState_[code]     = currentKeyState_[code];
+    currentKeyState_[code]  = pressed;
+    injectedKeyState_[code] = pressed;
+}
+
+void UserInput::setReplaying( bool replaying )
+{
+    replaying_ = replaying;
 }
@@ -82,6 +82,8 @@ public:
         KeyCodeToggleCollectionInfo,
         KeyCodeToggleBuildInfo,
         KeyCodeSettings,
+        KeyCodeToggleProfiler,
+        KeyCodeDumpProfiler,
         // leave KeyCodeMax at the end
         KeyCodeMax,
     };
@@ -94,9 +96,17 @@ public:
     bool keystate(KeyCode_E) const;
     bool lastKeyPressed(KeyCode_E code) const;
     bool newKeyPressed(KeyCode_E code) const;
+    bool anyKeyPressed() const;
     void clearJoysticks();
     void reconfigure();
     void updateKeystate();
+    // Looks up a control by its controls.conf name, e.g. "letterDown"
+    static bool keyCode(const std::string& name, KeyCode_E& code);
+    static const char* keyName(KeyCode_E code);
+    // Presses or releases a control from code, independent of any mapped device
+    void setKeystate(KeyCode_E code, bool pressed);
+    // While replaying, mapped devices are ignored and only setKeystate() moves controls
+    void setReplaying(bool replaying);
 
 private:
     bool MapKey(const std::string& keyDescription, KeyCode_E key);
@@ -105,8 +115,10 @@ private:
     bool MapKeyCombo(const std::string& keyDescription, KeyCode_E key1, KeyCode_E key2, bool required);
     Configuration& config_;
     bool updated_{ false };
+    bool replaying_{ false };
     SDL_JoystickID joysticks_[cMaxJoy];
     std::vector<std::pair<InputHandler *, KeyCode_E> > keyHandlers_;
     bool lastKeyState_[KeyCodeMax]; 
     bool currentKeyState_[KeyCodeMax]; 
+    bool injectedKeyState_[KeyCodeMax];
 };
@@ -32,6 +32,9 @@ const global_options::options_entry global_options::s_option_entries[] =
     { nullptr,                        nullptr,     global_options::option_type::HEADER,   "LOGGING OPTIONS" },
     { OPTION_LOG,                     "NONE",      global_options::option_type::STRING,   "Set logging level, any combo of ERROR,INFO,NOTICE,WARNING,DEBUG,FILECACHE or ALL or NONE" },
     { OPTION_DUMPPROPERTIES,          "false",     global_options::option_type::BOOLEAN,  "Dump contents of properties to txt in current directory"},
+    { OPTION_PROFILER,                "false",     global_options::option_type::BOOLEAN,  "Time each frame phase and show the results over the layout" },
+    { OPTION_RECORDINPUT,             "",          global_options::option_type::STRING,   "Record controls and frame times to this file for replayInput" },
+    { OPTION_REPLAYINPUT,             "",          global_options::option_type::STRING,   "Replay a recordInput file instead of live input" },
 
     { nullptr,                        nullptr,     global_options::option_type::HEADER,   "DISPLAY OPTIONS" },
     { OPTION_NUMSCREENS,              "1",         global_options::option_type::INTEGER,  "Defines the number of monitors used" },
@@ -44,18 +47,24 @@ const global_options::options_entry global_options::s_option_entries[] =
     { OPTION_SCREENNUMX,              "",          global_options::option_type::INTEGER,  "Define which monitor x is which display window, Screen numbers start at 0!"},
     { OPTION_MIRRORX,                 "false",     global_options::option_type::BOOLEAN,  "Divides monitor x into two halves" },
     { OPTION_ROTATIONX,               "0",         global_options::option_type::INTEGER,  "Rotation of monitor x (0, 1, 2, 3)" },
+    { OPTION_COMPOSITEX,              "false",     global_options::option_type::BOOLEAN,  "Draw monitor x at layout size and rotate, mirror and scale it in one final copy" },
 
     { nullptr,                        nullptr,     global_options::option_type::HEADER,   "WINDOW OPTIONS" },
     { OPTION_WINDOWBORDER,            "false",     global_options::option_type::BOOLEAN,  "Show window border" },
     { OPTION_WINDOWRESIZE,            "false",     global_options::option_type::BOOLEAN,  "Allow window to be resized" },
     { OPTION_FPS,                     "60",        global_options::option_type::INTEGER,  "Requested FPS while in an active state" },
     { OPTION_FPSIDLE,                 "60",        global_options::option_type::INTEGER,  "Request FPS while in an idle state" },
+    { OPTION_RENDERONDEMAND,          "false",     global_options::option_type::BOOLEAN,  "Stop redrawing while idle and nothing on screen changes" },
     { OPTION_HIDEMOUSE,               "true",      global_options::option_type::BOOLEAN,  "Defines whether the mouse cursor is hidden" },
     { OPTION_ANIMATEDURINGGAME,       "true",      global_options::option_type::BOOLEAN,  "Pause animated marquees while in the game" },
 
     { nullptr,                        nullptr,     global_options::option_type::HEADER,   "VIDEO OPTIONS" },
     { OPTION_VIDEOENABLE,             "true",      global_options::option_type::BOOLEAN,  "Defines whether video is rendered" },
     { OPTION_VIDEOLOOP,               "0",         global_options::option_type::INTEGER,  "Number of times to play video, 0 forever" },
+    { OPTION_VIDEOPOOLSIZE,           "4",         global_options::option_type::INTEGER,  "Number of idle video pipelines kept for reuse" },
+    { OPTION_VIDEOPREROLL,            "2",         global_options::option_type::INTEGER,  "Number of upcoming items whose video is prerolled, per video component" },
+    { OPTION_VIDEOPOSTERS,            "true",      global_options::option_type::BOOLEAN,  "Show a cached first frame while a video starts" },
+    { OPTION_VIDEOMAXDECODES,         "0",         global_options::option_type::INTEGER,  "Number of videos allowed to decode at once, 0 for one per core" },
     { OPTION_DISABLEVIDEORESTART,     "false",     global_options::option_type::BOOLEAN,  "Pauses video while scrolling" },
     { OPTION_DISABLEPAUSEONSCROLL,    "false",     global_options::option_type::BOOLEAN,  "Restart video when selected" },
 
@@ -66,6 +75,7 @@ const global_options::options_entry global_options::s_option_entries[] =
     { OPTION_MUTEVIDEO,                "false",    global_options::option_type::BOOLEAN,  "Video playback is muted" },
     { OPTION_SDLRENDERDRIVER,          "direct3d", global_options::option_type::STRING,   "Set renderer (direct3d, direct3d11, direct3d12, opengl, opengles2, opengles, metal, and software)" },
     { OPTION_SCALEQUALITY,             "1",        global_options::option_type::INTEGER,  "Scaling quality (0, 1, 2)" },
+    { OPTION_CACHESTATICLAYERS,        "false",    global_options::option_type::BOOLEAN,  "Flatten idle background images into one cached texture per monitor" },
     { OPTION_HIGHPRIORITY,             "false",    global_options::option_type::BOOLEAN,  "RetroFE Windows process priority" },
     { OPTION_UNLOADSDL,                "false",    global_options::option_type::BOOLEAN,  "Close SDL when launching a game, MUST be true for RPI" },
     { OPTION_MINIMIZEONFOCUSLOSS,      "false",    global_options::option_type::BOOLEAN,  "Minimize RetroFE when focus is lost" },
@@ -23,6 +23,9 @@
 // LOGGING OPTIONS
 #define OPTION_LOG                   "log"
 #define OPTION_DUMPPROPERTIES        "dumpProperties"
+#define OPTION_PROFILER              "profiler"
+#define OPTION_RECORDINPUT           "recordInput"
+#define OPTION_REPLAYINPUT           "replayInput"
 
 // DISPLAY OPTIONS
 #define OPTION_NUMSCREENS            "numScreens"
@@ -32,24 +35,31 @@
 #define OPTION_SCREENNUM             "screenNum"
 #define OPTION_MIRROR                "mirror"
 #define OPTION_ROTATION              "rotation"
+#define OPTION_COMPOSITE             "composite"
 #define OPTION_FULLSCREENX           "fullscreenx"
 #define OPTION_HORIZONTALX           "horizontalx"
 #define OPTION_VERTICALX             "verticalx"
 #define OPTION_SCREENNUMX            "screenNumx"
 #define OPTION_MIRRORX               "mirrorx"
 #define OPTION_ROTATIONX             "rotationx"
+#define OPTION_COMPOSITEX            "compositex"
 
 // WINDOW OPTIONS
 #define OPTION_WINDOWBORDER          "windowBorder"
 #define OPTION_WINDOWRESIZE          "windowResize"
 #define OPTION_FPS                   "fps"
 #define OPTION_FPSIDLE               "fpsIdle"
+#define OPTION_RENDERONDEMAND        "renderOnDemand"
 #define OPTION_HIDEMOUSE             "hideMouse"
 #define OPTION_ANIMATEDURINGGAME     "animateDuringGame"
 
 // VIDEO OPTIONS
 #define OPTION_VIDEOENABLE           "videoEnable"
 #define OPTION_VIDEOLOOP             "videoLoop"
+#define OPTION_VIDEOPOOLSIZE         "videoPoolSize"
+#define OPTION_VIDEOPREROLL          "videoPreroll"
+#define OPTION_VIDEOPOSTERS          "videoPosters"
+#define OPTION_VIDEOMAXDECODES       "videoMaxDecodes"
 #define OPTION_DISABLEVIDEORESTART   "disableVideoRestart"
 #define OPTION_DISABLEPAUSEONSCROLL  "disablePauseOnScroll"
 
@@ -60,6 +70,7 @@
 #define OPTION_MUTEVIDEO             "MuteVideo"
 #define OPTION_SDLRENDERDRIVER       "SDLRenderDriver"
 #define OPTION_SCALEQUALITY          "ScaleQuality"
+#define OPTION_CACHESTATICLAYERS     "cacheStaticLayers"
 #define OPTION_HIGHPRIORITY          "highPriority"
 #define OPTION_UNLOADSDL             "unloadSDL"
 #define OPTION_MINIMIZEONFOCUSLOSS   "minimizeOnFocusLoss"
@@ -156,6 +167,9 @@ public:
     // Definition of functions to directly return the values of specific options
     const char* log() { return value(OPTION_LOG); }
     bool dumpproperties() { return bool_value(OPTION_DUMPPROPERTIES); }
+    bool profiler() { return bool_value(OPTION_PROFILER); }
+    const char* recordinput() { return value(OPTION_RECORDINPUT); }
+    const char* replayinput() { return value(OPTION_REPLAYINPUT); }
 
     int numscreens() { return int_value(OPTION_NUMSCREENS); }
     bool fullscreen() { return bool_value(OPTION_FULLSCREEN); }
@@ -168,16 +182,22 @@ public:
     int screennumx() { return int_value(OPTION_SCREENNUMX); }
     bool mirrorx() { return bool_value(OPTION_MIRRORX); }
     int rotationx() { return int_value(OPTION_ROTATIONX); }
+    bool compositex() { return bool_value(OPTION_COMPOSITEX); }
     
     bool windowborder() { return bool_value(OPTION_WINDOWBORDER); }
     bool windowresize() { return bool_value(OPTION_WINDOWRESIZE); }
     int fps() { return int_value(OPTION_FPS); }
     int fpsidle() { return int_value(OPTION_FPSIDLE); }
+    bool renderondemand() { return bool_value(OPTION_RENDERONDEMAND); }
     bool hidemouse() { return bool_value(OPTION_HIDEMOUSE); }
     bool animateduringgame() { return bool_value(OPTION_ANIMATEDURINGGAME); }
     
     bool videoenable() { return bool_value(OPTION_VIDEOENABLE); }
     int videoloop() { return int_value(OPTION_VIDEOLOOP); }
+    int videopoolsize() { return int_value(OPTION_VIDEOPOOLSIZE); }
+    int videopreroll() { return int_value(OPTION_VIDEOPREROLL); }
+    bool videoposters() { return bool_value(OPTION_VIDEOPOSTERS); }
+    int videomaxdecodes() { return int_value(OPTION_VIDEOMAXDECODES); }
     bool disablevideorestart() { return bool_value(OPTION_DISABLEVIDEORESTART); }
     bool disablepauseonscroll() { return bool_value(OPTION_DISABLEPAUSEONSCROLL); }
     
@@ -187,6 +207,7 @@ public:
     bool mutevideo() { return bool_value(OPTION_MUTEVIDEO); }
     int sdlrenderdriver() { return int_value(OPTION_SDLRENDERDRIVER); }
     int scalequality() { return int_value(OPTION_SCALEQUALITY); }
+    bool cachestaticlayers() { return bool_value(OPTION_CACHESTATICLAYERS); }
     bool highpriority() { return bool_value(OPTION_HIGHPRIORITY); }
     bool unloadsdl() { return bool_value(OPTION_UNLOADSDL); }
     bool minimizeonfocusloss() { return bool_value(OPTION_MINIMIZEONFOCUSLOSS); }
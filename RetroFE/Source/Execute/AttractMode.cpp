@@ -16,6 +16,8 @@
 #include "AttractMode.h"
 #include "../Graphics/Page.h"
 
+#include <algorithm>
+#include <cfloat>
 #include <cstdlib>
 
 AttractMode::AttractMode()
@@ -122,3 +124,25 @@ bool AttractMode::isSet() const
 {
     return isSet_;
 }
+
+
+// Seconds until update() acts on its own; FLT_MAX when no timer is armed
+float AttractMode::timeToNextEvent(Page &page) const
+{
+    if ( isActive_ )
+        return 0;
+
+    if ( page.isJukebox() )
+        return std::max( 10 - elapsedTime_, 0.0f );
+
+    float next = FLT_MAX;
+    if ( idleTime > 0 )
+        next = std::min( next, idleTime - elapsedTime_ );
+    if ( isSet_ && idleNextTime > 0 )
+        next = std::min( next, idleNextTime - elapsedTime_ );
+    if ( idlePlaylistTime > 0 )
+        next = std::min( next, idlePlaylistTime - elapsedPlaylistTime_ );
+    if ( idleCollectionTime > 0 )
+        next = std::min( next, idleCollectionTime - elapsedCollectionTime_ );
+    return std::max( next, 0.0f );
+}
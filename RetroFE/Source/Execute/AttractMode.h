@@ -33,6 +33,7 @@ public:
     bool  isActive() const;
     void activate();
     bool  isSet() const;
+    float timeToNextEvent(Page &page) const;
 
 private:
     bool isActive_;
@@ -0,0 +1,489 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "Benchmark.h"
+#include "../Database/Configuration.h"
+#include "../Utility/Log.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#ifdef WIN32
+    #include <Windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+// A press that gets no reaction, or a page that never settles, must not stall the run
+static const double pressTimeout  = 2;
+static const double settleTimeout = 30;
+
+Benchmark *Benchmark::active_ = nullptr;
+std::mutex Benchmark::statsMutex_;
+unsigned int Benchmark::textures_ = 0;
+unsigned int Benchmark::framesDrawn_ = 0;
+unsigned int Benchmark::framesSkipped_ = 0;
+double Benchmark::textureTime_ = 0;
+std::vector<Benchmark::Collection> Benchmark::collections_;
+long long Benchmark::fontAtlasBytes_ = 0;
+long long Benchmark::fontFieldBytes_ = 0;
+long long Benchmark::fontAtlasPeak_ = 0;
+long long Benchmark::fontFieldPeak_ = 0;
+long long Benchmark::fontPeak_ = 0;
+unsigned int Benchmark::videoStarts_[VideoStartCount] = { 0, 0, 0 };
+double Benchmark::videoStartTime_[VideoStartCount] = { 0, 0, 0 };
+unsigned int Benchmark::videoFramesShown_ = 0;
+unsigned int Benchmark::videoFramesDropped_ = 0;
+unsigned int Benchmark::videoFramesLate_ = 0;
+unsigned long long Benchmark::videoUploadBytes_ = 0;
+unsigned int Benchmark::videoLoops_ = 0;
+double Benchmark::videoLoopTime_ = 0;
+double Benchmark::videoLoopMax_ = 0;
+unsigned int Benchmark::videoDecodeSamples_ = 0;
+unsigned long long Benchmark::videoDecodesRunning_ = 0;
+unsigned int Benchmark::videoDecodesPeak_ = 0;
+unsigned int Benchmark::videoDecodesThrottledFrames_ = 0;
+
+static long peakResidentKb()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+// User plus system time of the whole process, all threads included
+static double cpuSeconds()
+{
+#ifdef WIN32
+    FILETIME created, exited, kernel, user;
+    if (!GetProcessTimes(GetCurrentProcess(), &created, &exited, &kernel, &user)) {
+        return 0;
+    }
+    auto ticks = [](const FILETIME &time) {
+        return (static_cast<unsigned long long>(time.dwHighDateTime) << 32) | time.dwLowDateTime;
+    };
+    return static_cast<double>(ticks(kernel) + ticks(user)) / 1e7;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+           static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#endif
+}
+
+static std::string jsonString(const std::string &value)
+{
+    std::string out = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20) {
+            out += ' ';
+        }
+        else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+Benchmark::Benchmark(const std::string &script)
+    : script_(script)
+    , current_(0)
+    , started_(false)
+    , stepBegun_(false)
+    , keyDown_(false)
+    , settling_(false)
+    , presses_(0)
+    , elapsed_(0)
+    , key_(UserInput::KeyCodeNull)
+{
+    active_ = this;
+}
+
+bool Benchmark::load(std::vector<std::string> &settings)
+{
+    std::ifstream file(script_.c_str());
+    if (!file.is_open()) {
+        LOG_ERROR("Benchmark", "Could not open script " + script_);
+        return false;
+    }
+
+    std::string line;
+    int lineCount = 0;
+    while (std::getline(file, line)) {
+        lineCount++;
+        line = Configuration::trimEnds(line);
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream ss(line);
+        std::string command;
+        ss >> command;
+
+        Step step;
+        step.text        = line;
+        step.count       = 1;
+        step.seconds     = 0;
+        step.duration    = 0;
+        step.textures    = 0;
+        step.textureTime = 0;
+
+        bool valid = true;
+        if (command == "set") {
+            std::string setting = line.substr(3);
+            size_t      equals  = setting.find('=');
+            valid = equals != std::string::npos;
+            if (valid) {
+                settings.push_back(Configuration::trimEnds(setting.substr(0, equals)) + "=" + Configuration::trimEnds(setting.substr(equals + 1)) + "\n");
+            }
+            else {
+                LOG_ERROR("Benchmark", script_ + ":" + std::to_string(lineCount) + " expected set <setting> = <value>");
+                return false;
+            }
+            continue;
+        }
+        else if (command == "wait") {
+            step.type = StepWait;
+            valid = static_cast<bool>(ss >> step.seconds);
+        }
+        else if (command == "press") {
+            step.type = StepPress;
+            valid = static_cast<bool>(ss >> step.control);
+            if (valid && !(ss >> step.count)) {
+                step.count = 1;
+            }
+        }
+        else if (command == "hold") {
+            step.type = StepHold;
+            valid = static_cast<bool>(ss >> step.control >> step.seconds);
+        }
+        else {
+            valid = false;
+        }
+
+        if (!valid || step.count < 1) {
+            LOG_ERROR("Benchmark", script_ + ":" + std::to_string(lineCount) + " could not parse \"" + line + "\"");
+            return false;
+        }
+        steps_.push_back(step);
+    }
+
+    LOG_INFO("Benchmark", "Loaded " + std::to_string(steps_.size()) + " steps from " + script_);
+    return true;
+}
+
+void Benchmark::update(UserInput &input, bool idle, double dt)
+{
+    if (isDone()) {
+        return;
+    }
+
+    // The timeline starts once the first page is up and waiting for input
+    if (!started_) {
+        if (!idle) {
+            return;
+        }
+        started_ = true;
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        steps_[current_].textures    = textures_;
+        steps_[current_].textureTime = textureTime_;
+        LOG_INFO("Benchmark", "Starting " + steps_[current_].text);
+        return;
+    }
+
+    Step &step = steps_[current_];
+    float ms = static_cast<float>(dt * 1000);
+    step.frames.push_back(ms);
+    frames_.push_back(ms);
+    step.duration += dt;
+    elapsed_      += dt;
+
+    if (step.type == StepWait) {
+        if (elapsed_ >= step.seconds) {
+            nextStep();
+        }
+        return;
+    }
+
+    if (!stepBegun_) {
+        stepBegun_ = true;
+        if (!UserInput::keyCode(step.control, key_)) {
+            LOG_ERROR("Benchmark", "Unknown control \"" + step.control + "\" in \"" + step.text + "\"");
+            nextStep();
+            return;
+        }
+    }
+
+    if (step.type == StepHold) {
+        if (elapsed_ < step.seconds) {
+            // Re-assert every frame, the way a held key keeps repeating
+            input.setKeystate(key_, true);
+            keyDown_ = true;
+        }
+        else if (keyDown_) {
+            input.setKeystate(key_, false);
+            keyDown_ = false;
+            elapsed_ = 0;
+        }
+        else if (idle || elapsed_ > settleTimeout) {
+            nextStep();
+        }
+        return;
+    }
+
+    // StepPress: hold the control until RetroFE reacts, then wait for the page to settle
+    if (!keyDown_ && !settling_) {
+        input.setKeystate(key_, true);
+        keyDown_ = true;
+        elapsed_ = 0;
+    }
+    else if (keyDown_) {
+        if (!idle || elapsed_ > pressTimeout) {
+            if (idle) {
+                LOG_WARNING("Benchmark", "No reaction to \"" + step.text + "\"");
+            }
+            input.setKeystate(key_, false);
+            keyDown_  = false;
+            settling_ = true;
+            elapsed_  = 0;
+        }
+    }
+    else if (idle || elapsed_ > settleTimeout) {
+        if (!idle) {
+            LOG_WARNING("Benchmark", "Page did not settle after \"" + step.text + "\"");
+        }
+        settling_ = false;
+        if (++presses_ >= step.count) {
+            nextStep();
+        }
+    }
+}
+
+void Benchmark::nextStep()
+{
+    Step &step = steps_[current_];
+    {
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        step.textures    = textures_ - step.textures;
+        step.textureTime = textureTime_ - step.textureTime;
+    }
+
+    current_++;
+    stepBegun_ = false;
+    keyDown_   = false;
+    settling_  = false;
+    presses_   = 0;
+    elapsed_ = 0;
+    if (isDone()) {
+        LOG_INFO("Benchmark", "Finished");
+        return;
+    }
+
+    // Counters at the start, turned into deltas when the step ends
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    steps_[current_].textures    = textures_;
+    steps_[current_].textureTime = textureTime_;
+    LOG_INFO("Benchmark", "Starting " + steps_[current_].text);
+}
+
+bool Benchmark::isDone() const
+{
+    return current_ >= steps_.size();
+}
+
+bool Benchmark::isActive()
+{
+    return active_ != nullptr;
+}
+
+void Benchmark::textureLoaded(double seconds)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    textures_++;
+    textureTime_ += seconds;
+}
+
+void Benchmark::frameDrawn(bool drawn)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    if (drawn) {
+        framesDrawn_++;
+    }
+    else {
+        framesSkipped_++;
+    }
+}
+
+void Benchmark::collectionBuilt(const std::string &name, double seconds)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    collections_.push_back({ name, seconds });
+}
+
+void Benchmark::fontMemory(long long atlasBytes, long long fieldBytes)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    fontAtlasBytes_ += atlasBytes;
+    fontFieldBytes_ += fieldBytes;
+    fontAtlasPeak_ = std::max(fontAtlasPeak_, fontAtlasBytes_);
+    fontFieldPeak_ = std::max(fontFieldPeak_, fontFieldBytes_);
+    fontPeak_ = std::max(fontPeak_, fontAtlasBytes_ + fontFieldBytes_);
+}
+
+void Benchmark::videoStarted(VideoStart start, double seconds)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    videoStarts_[start]++;
+    videoStartTime_[start] += seconds;
+}
+
+void Benchmark::videoFrames(unsigned int shown, unsigned int dropped, unsigned int late, unsigned long long bytes)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    videoFramesShown_   += shown;
+    videoFramesDropped_ += dropped;
+    videoFramesLate_    += late;
+    videoUploadBytes_   += bytes;
+}
+
+void Benchmark::videoLooped(double seconds)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    videoLoops_++;
+    videoLoopTime_ += seconds;
+    videoLoopMax_ = std::max(videoLoopMax_, seconds);
+}
+
+void Benchmark::videoDecodes(unsigned int running, unsigned int throttled)
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    videoDecodeSamples_++;
+    videoDecodesRunning_ += running;
+    videoDecodesPeak_ = std::max(videoDecodesPeak_, running);
+    if (throttled) {
+        videoDecodesThrottledFrames_++;
+    }
+}
+
+std::string Benchmark::frameStats(const std::vector<float> &frames)
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+    if (frames.empty()) {
+        ss << "{ \"count\": 0 }";
+        return ss.str();
+    }
+
+    std::vector<float> sorted(frames);
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0;
+    for (float ms : sorted) {
+        sum += ms;
+    }
+    auto percentile = [&sorted](size_t p) { return sorted[(sorted.size() - 1) * p / 100]; };
+
+    ss << "{ \"count\": " << sorted.size()
+       << ", \"meanMs\": " << sum / static_cast<double>(sorted.size())
+       << ", \"p50Ms\": " << percentile(50)
+       << ", \"p95Ms\": " << percentile(95)
+       << ", \"p99Ms\": " << percentile(99)
+       << ", \"maxMs\": " << sorted.back() << " }";
+    return ss.str();
+}
+
+bool Benchmark::writeResults(const std::string &file) const
+{
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(3);
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    ss << "{" << std::endl;
+    ss << "  \"script\": " << jsonString(script_) << "," << std::endl;
+    ss << "  \"completed\": " << (isDone() ? "true" : "false") << "," << std::endl;
+    ss << "  \"frames\": " << frameStats(frames_) << "," << std::endl;
+    ss << "  \"redraws\": { \"drawn\": " << framesDrawn_ << ", \"skipped\": " << framesSkipped_ << " }," << std::endl;
+    ss << "  \"cpuSeconds\": " << cpuSeconds() << "," << std::endl;
+    ss << "  \"textureLoads\": { \"count\": " << textures_ << ", \"totalMs\": " << textureTime_ * 1000 << " }," << std::endl;
+    ss << "  \"collections\": [";
+    for (size_t i = 0; i < collections_.size(); i++) {
+        ss << (i ? "," : "") << std::endl << "    { \"name\": " << jsonString(collections_[i].name)
+           << ", \"buildMs\": " << collections_[i].seconds * 1000 << " }";
+    }
+    ss << std::endl << "  ]," << std::endl;
+    ss << "  \"fontMemoryKb\": { \"atlasPeak\": " << fontAtlasPeak_ / 1024 << ", \"fieldPeak\": " << fontFieldPeak_ / 1024
+       << ", \"peak\": " << fontPeak_ / 1024 << " }," << std::endl;
+    ss << "  \"videoStarts\": {";
+    static const char *startNames[VideoStartCount] = { "new", "pooled", "prerolled" };
+    for (int start = 0; start < VideoStartCount; start++) {
+        double meanMs = videoStarts_[start] ? videoStartTime_[start] * 1000 / videoStarts_[start] : 0;
+        ss << (start ? ", " : " ") << jsonString(startNames[start]) << ": { \"count\": " << videoStarts_[start]
+           << ", \"meanFirstFrameMs\": " << meanMs << " }";
+    }
+    ss << " }," << std::endl;
+    ss << "  \"videoFrames\": { \"shown\": " << videoFramesShown_ << ", \"dropped\": " << videoFramesDropped_
+       << ", \"late\": " << videoFramesLate_ << ", \"uploadMb\": " << static_cast<double>(videoUploadBytes_) / (1024 * 1024) << " }," << std::endl;
+    ss << "  \"videoLoops\": { \"count\": " << videoLoops_ << ", \"meanGapMs\": " << (videoLoops_ ? videoLoopTime_ * 1000 / videoLoops_ : 0)
+       << ", \"maxGapMs\": " << videoLoopMax_ * 1000 << " }," << std::endl;
+    ss << "  \"videoDecodes\": { \"mean\": " << (videoDecodeSamples_ ? static_cast<double>(videoDecodesRunning_) / videoDecodeSamples_ : 0)
+       << ", \"peak\": " << videoDecodesPeak_ << ", \"throttledFrames\": " << videoDecodesThrottledFrames_ << " }," << std::endl;
+    ss << "  \"peakRssKb\": " << peakResidentKb() << "," << std::endl;
+    ss << "  \"steps\": [";
+    for (size_t i = 0; i < steps_.size(); i++) {
+        const Step &step = steps_[i];
+        bool finished = i < current_;
+        ss << (i ? "," : "") << std::endl << "    { \"step\": " << jsonString(step.text)
+           << ", \"seconds\": " << step.duration
+           << ", \"textureLoads\": " << (finished ? step.textures : 0)
+           << ", \"textureMs\": " << (finished ? step.textureTime * 1000 : 0)
+           << ", \"frames\": " << frameStats(step.frames) << " }";
+    }
+    ss << std::endl << "  ]" << std::endl << "}" << std::endl;
+
+    std::cout << ss.str();
+    if (file.empty()) {
+        return true;
+    }
+
+    std::ofstream out(file.c_str());
+    if (!out.is_open()) {
+        LOG_ERROR("Benchmark", "Could not write results to " + file);
+        return false;
+    }
+    out << ss.str();
+    LOG_INFO("Benchmark", "Results written to " + file);
+    return out.good();
+}
@@ -0,0 +1,136 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "../Control/UserInput.h"
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Replays a scripted input timeline and records how long frames, texture loads and
+// collection builds take, for comparing builds and layouts without a person at the
+// controls. Script lines are:
+//   set <setting> = <value>    settings.conf override, e.g. set layout = Arcades
+//   wait <seconds>             let the page run untouched
+//   press <control> [count]    press and release a control, waiting for the page to
+//                              settle after each press
+//   hold <control> <seconds>   keep a control down, e.g. for accelerated scrolling
+class Benchmark
+{
+public:
+    explicit Benchmark(const std::string &script);
+    bool load(std::vector<std::string> &settings);
+
+    // Advances the timeline by one frame; idle is true when RetroFE waits for input
+    // and nothing on the page is moving
+    void update(UserInput &input, bool idle, double dt);
+    bool isDone() const;
+    bool writeResults(const std::string &file) const;
+
+    static bool isActive();
+    static void textureLoaded(double seconds);
+    // Whether a pass of the main loop drew the page or found it unchanged and slept
+    static void frameDrawn(bool drawn);
+    static void collectionBuilt(const std::string &name, double seconds);
+    // Bytes of glyph atlas and distance field a font allocated (positive) or freed (negative)
+    static void fontMemory(long long atlasBytes, long long fieldBytes);
+    // Where a video's pipeline came from when it started playing
+    enum VideoStart
+    {
+        VideoStartNew,
+        VideoStartPooled,
+        VideoStartPrerolled,
+        VideoStartCount
+    };
+
+    // Time from play() to the first decoded frame, split by where the pipeline came from
+    static void videoStarted(VideoStart start, double seconds);
+    // Frames a video uploaded, dropped because rendering fell behind, and skipped for
+    // arriving late from the decoder, and the bytes it uploaded
+    static void videoFrames(unsigned int shown, unsigned int dropped, unsigned int late, unsigned long long bytes);
+    // Wall time between the last frame of a video's pass and the first of its next loop
+    static void videoLooped(double seconds);
+    // Videos decoding this frame and videos the governor paused to stay under its cap
+    static void videoDecodes(unsigned int running, unsigned int throttled);
+
+private:
+    enum StepType
+    {
+        StepWait,
+        StepPress,
+        StepHold
+    };
+
+    struct Step
+    {
+        StepType type;
+        std::string text;
+        std::string control;
+        int count;
+        double seconds;
+        std::vector<float> frames;
+        double duration;
+        unsigned int textures;
+        double textureTime;
+    };
+
+    struct Collection
+    {
+        std::string name;
+        double seconds;
+    };
+
+    void nextStep();
+    static std::string frameStats(const std::vector<float> &frames);
+
+    std::string script_;
+    std::vector<Step> steps_;
+    std::vector<float> frames_;
+    size_t current_;
+    bool started_;
+    bool stepBegun_;
+    bool keyDown_;
+    bool settling_;
+    int presses_;
+    double elapsed_;
+    UserInput::KeyCode_E key_;
+
+    static Benchmark *active_;
+    static std::mutex statsMutex_;
+    static unsigned int textures_;
+    static unsigned int framesDrawn_;
+    static unsigned int framesSkipped_;
+    static double textureTime_;
+    static std::vector<Collection> collections_;
+    static long long fontAtlasBytes_;
+    static long long fontFieldBytes_;
+    static long long fontAtlasPeak_;
+    static long long fontFieldPeak_;
+    static long long fontPeak_;
+    static unsigned int videoStarts_[VideoStartCount];
+    static double videoStartTime_[VideoStartCount];
+    static unsigned int videoFramesShown_;
+    static unsigned int videoFramesDropped_;
+    static unsigned int videoFramesLate_;
+    static unsigned long long videoUploadBytes_;
+    static unsigned int videoLoops_;
+    static double videoLoopTime_;
+    static double videoLoopMax_;
+    static unsigned int videoDecodeSamples_;
+    static unsigned long long videoDecodesRunning_;
+    static unsigned int videoDecodesPeak_;
+    static unsigned int videoDecodesThrottledFrames_;
+};
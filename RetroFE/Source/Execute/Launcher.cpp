@@ -19,6 +19,8 @@
 #include "../Utility/Log.h"
 #include "../Database/Configuration.h"
 #include "../Utility/Utils.h"
+#include "../Utility/FramePacer.h"
+#include "../Utility/FrameProfiler.h"
 #include "../RetroFE.h"
 #include "../SDL.h"
 #include "../Database/GlobalOpts.h"
@@ -359,44 +361,46 @@ bool Launcher::execute(std::string executable, std::string args, std::string cur
 
 void Launcher::keepRendering(std::atomic<bool> &stop_thread, Page &currentPage)
 {
-    float lastTime = 0;
-    float currentTime = 0;
-    float deltaTime = 0;
-    double sleepTime;
-    double fpsTime = 1000.0 / static_cast<double>(60);
+    FramePacer pacer;
+    pacer.setPeriod(1.0 / 60);
 
     while (!stop_thread) {
-        lastTime = currentTime;
-        currentTime = static_cast<float>(SDL_GetTicks()) / 1000;
-
-        if (currentTime < lastTime) {
-            currentTime = lastTime;
+        {
+            FrameProfiler::Scope pacing(FrameProfiler::PhasePacing);
+            pacer.tick();
         }
-
-        deltaTime = currentTime - lastTime;
-        sleepTime = fpsTime - deltaTime * 1000;
-            
-        if (sleepTime > 0 && sleepTime < 1000) {
-            SDL_Delay(static_cast<unsigned int>(sleepTime));
+        {
+            FrameProfiler::Scope update(FrameProfiler::PhaseUpdate);
+            currentPage.update(0.0);
         }
-        currentPage.update(float(0));
-        SDL_LockMutex(SDL::getMutex());
-
-        // start on secondary monitor
-        // todo support future main screen swap
-        for (int i = 1; i < SDL::getScreenCount(); ++i) {
-            SDL_SetRenderDrawColor(SDL::getRenderer(i), 0x0, 0x0, 0x00, 0xFF);
-            SDL_RenderClear(SDL::getRenderer(i));
+        SDL::beginFrame();
+
+        {
+            FrameProfiler::Scope draw(FrameProfiler::PhaseDraw);
+
+            // start on secondary monitor
+            // todo support future main screen swap
+            for (int i = 1; i < SDL::getScreenCount(); ++i) {
+                SDL_SetRenderDrawColor(SDL::getRenderer(i), 0x0, 0x0, 0x00, 0xFF);
+                SDL_RenderClear(SDL::getRenderer(i));
+            }
+
+            currentPage.draw();
         }
 
-        currentPage.draw();
+        {
+            FrameProfiler::Scope present(FrameProfiler::PhasePresent);
+            SDL::endFrame();
 
-        for (int i = 1; i < SDL::getScreenCount(); ++i) {
-            SDL_RenderPresent(SDL::getRenderer(i));
+            for (int i = 1; i < SDL::getScreenCount(); ++i) {
+                SDL_RenderPresent(SDL::getRenderer(i));
+            }
         }
 
-        SDL_UnlockMutex(SDL::getMutex());
+        FrameProfiler::endFrame();
     }
+    if (Logger::isLevelEnabled("DEBUG"))
+        LOG_DEBUG("Launcher", "Frame times while running the game:\n" + pacer.histogram());
 }
 
 bool Launcher::launcherName(std::string &launcherName, std::string collection)
@@ -26,42 +26,41 @@ AnimationEvents::~AnimationEvents()
     clear();
 }
 
-Animation *AnimationEvents::getAnimation(const std::string& tween)
+Animation *AnimationEvents::getAnimation(AnimationEvent event, int index) const
 {
-    return getAnimation(tween, -1);
-}
-
-Animation* AnimationEvents::getAnimation(const std::string& tween, int index)
-{
-    if (animationMap_.find(tween) == animationMap_.end())
-        animationMap_[tween][-1] = new Animation();
+    if (event < 0 || event >= EVENT_COUNT)
+        return nullptr;
 
-    if (animationMap_[tween].find(index) == animationMap_[tween].end())
-        index = -1;
+    const std::vector<Animation *> &byIndex = animations_[event];
+    if (index >= -1 && static_cast<size_t>(index + 1) < byIndex.size() && byIndex[index + 1])
+        return byIndex[index + 1];
 
-    return animationMap_[tween][index];
+    return byIndex.empty() ? nullptr : byIndex[0];
 }
 
 
-void AnimationEvents::setAnimation(const std::string& tween, int index, Animation *animation)
+void AnimationEvents::setAnimation(AnimationEvent event, int index, Animation *animation)
 {
-    if(animationMap_[tween].find(index) != animationMap_[tween].end())
-    {
-        delete animationMap_[tween][index];
+    if (event < 0 || event >= EVENT_COUNT || index < -1) {
+        delete animation;
+        return;
     }
-    animationMap_[tween][index] = animation;
+
+    std::vector<Animation *> &byIndex = animations_[event];
+    if (static_cast<size_t>(index + 1) >= byIndex.size())
+        byIndex.resize(index + 2, nullptr);
+
+    delete byIndex[index + 1];
+    byIndex[index + 1] = animation;
 }
 
 
 void AnimationEvents::clear()
 {
-    for (auto& [key, innerMap] : animationMap_) // This is the structured binding declaration
-    {
-        for (auto const& [innerKey, animation] : innerMap) // Another structured binding
-        {
+    for (auto &byIndex : animations_) {
+        for (Animation *animation : byIndex) {
             delete animation;
         }
-        innerMap.clear();
+        byIndex.clear();
     }
-    animationMap_.clear();
-}
\ No newline at end of file
+}
@@ -19,7 +19,6 @@
 #include "Animation.h"
 #include <string>
 #include <vector>
-#include <map>
 
 class AnimationEvents
 {
@@ -27,11 +26,13 @@ public:
     AnimationEvents();
     ~AnimationEvents();
 
-    Animation *getAnimation(const std::string& tween);
-    Animation *getAnimation(const std::string& tween, int index);
-    void setAnimation(const std::string& tween, int index, Animation *animation);
+    // Animation for event at a menu index, falling back to the one without an index (-1);
+    // nullptr when the layout has neither
+    Animation *getAnimation(AnimationEvent event, int index = -1) const;
+    void setAnimation(AnimationEvent event, int index, Animation *animation);
     void clear();
 
 private:
-    std::map<std::string, std::map<int, Animation *> > animationMap_;
+    // Per event, indexed by menu index + 1, so slot 0 holds the animation without an index
+    std::vector<Animation *> animations_[EVENT_COUNT];
 };
@@ -18,6 +18,7 @@
 #include <algorithm>
 #define _USE_MATH_DEFINES
 #include <math.h>
+#include <sstream>
 #include <string>
 
 std::map<std::string, TweenAlgorithm, std::less<>> Tween::tweenTypeMap_ = {
@@ -71,14 +72,77 @@ std::map<std::string, TweenProperty, std::less<>> Tween::tweenPropertyMap_ = {
     {"restart", TWEEN_PROPERTY_RESTART}
 };
 
+Interner Tween::playlists_;
+
 Tween::Tween(TweenProperty property, TweenAlgorithm type, double start, double end, double duration, const std::string& playlistFilter)
     : property(property)
     , duration(duration)
-    , playlistFilter(playlistFilter)
     , type(type)
 	, start(start)
     , end(end)
+    , target_(TargetFloat)
 {
+    switch (property) {
+    case TWEEN_PROPERTY_X:                field_ = &ViewInfo::X; break;
+    case TWEEN_PROPERTY_Y:                field_ = &ViewInfo::Y; break;
+    case TWEEN_PROPERTY_HEIGHT:           field_ = &ViewInfo::Height; break;
+    case TWEEN_PROPERTY_WIDTH:            field_ = &ViewInfo::Width; break;
+    case TWEEN_PROPERTY_ANGLE:            field_ = &ViewInfo::Angle; break;
+    case TWEEN_PROPERTY_ALPHA:            field_ = &ViewInfo::Alpha; break;
+    case TWEEN_PROPERTY_X_ORIGIN:         field_ = &ViewInfo::XOrigin; break;
+    case TWEEN_PROPERTY_Y_ORIGIN:         field_ = &ViewInfo::YOrigin; break;
+    case TWEEN_PROPERTY_X_OFFSET:         field_ = &ViewInfo::XOffset; break;
+    case TWEEN_PROPERTY_Y_OFFSET:         field_ = &ViewInfo::YOffset; break;
+    case TWEEN_PROPERTY_FONT_SIZE:        field_ = &ViewInfo::FontSize; break;
+    case TWEEN_PROPERTY_BACKGROUND_ALPHA: field_ = &ViewInfo::BackgroundAlpha; break;
+    case TWEEN_PROPERTY_MAX_WIDTH:        field_ = &ViewInfo::MaxWidth; break;
+    case TWEEN_PROPERTY_MAX_HEIGHT:       field_ = &ViewInfo::MaxHeight; break;
+    case TWEEN_PROPERTY_CONTAINER_X:      field_ = &ViewInfo::ContainerX; break;
+    case TWEEN_PROPERTY_CONTAINER_Y:      field_ = &ViewInfo::ContainerY; break;
+    case TWEEN_PROPERTY_CONTAINER_WIDTH:  field_ = &ViewInfo::ContainerWidth; break;
+    case TWEEN_PROPERTY_CONTAINER_HEIGHT: field_ = &ViewInfo::ContainerHeight; break;
+    case TWEEN_PROPERTY_VOLUME:           field_ = &ViewInfo::Volume; break;
+    case TWEEN_PROPERTY_LAYER:            target_ = TargetLayer; break;
+    case TWEEN_PROPERTY_MONITOR:          target_ = TargetMonitor; break;
+    case TWEEN_PROPERTY_RESTART:          target_ = TargetRestart; break;
+    case TWEEN_PROPERTY_NOP:              target_ = TargetNone; break;
+    }
+
+    // playlist1,playlist2,playlist3 matches any of the listed playlists
+    std::stringstream ss(playlistFilter);
+    std::string playlist;
+    while (std::getline(ss, playlist, ',')) {
+        if (!playlist.empty()) {
+            playlistIds_.push_back(playlistId(playlist));
+        }
+    }
+}
+
+
+int Tween::playlistId(std::string_view name)
+{
+    return name.empty() ? -1 : playlists_.intern(name);
+}
+
+
+void Tween::apply(ViewInfo &info, const ViewInfo &startInfo, double elapsedTime) const
+{
+    switch (target_) {
+    case TargetFloat:
+        info.*field_ = startDefined ? animate(elapsedTime) : animate(elapsedTime, startInfo.*field_);
+        break;
+    case TargetLayer:
+        info.Layer = static_cast<unsigned int>(startDefined ? animate(elapsedTime) : animate(elapsedTime, startInfo.Layer));
+        break;
+    case TargetMonitor:
+        info.Monitor = static_cast<unsigned int>(startDefined ? animate(elapsedTime) : animate(elapsedTime, startInfo.Monitor));
+        break;
+    case TargetRestart:
+        info.Restart = (duration != 0.0) && (elapsedTime == 0.0);
+        break;
+    case TargetNone:
+        break;
+    }
 }
 
 
@@ -220,6 +284,113 @@ float Tween::animateSingle(TweenAlgorithm type, double start, double end, double
 
 }
 
+// Same curves as the double versions below, written as f(t/d) without branches so the
+// compiler can vectorize each loop; u = 1 - f runs from the end back to the start
+void Tween::easeBatch(TweenAlgorithm type, float *f, size_t count)
+{
+    const float halfPi = static_cast<float>(M_PI / 2);
+    const float pi     = static_cast<float>(M_PI);
+
+    switch (type) {
+    case EASE_IN_QUADRATIC:
+        for (size_t i = 0; i < count; i++) f[i] = f[i] * f[i];
+        break;
+    case EASE_OUT_QUADRATIC:
+        for (size_t i = 0; i < count; i++) f[i] = f[i] * (2 - f[i]);
+        break;
+    case EASE_INOUT_QUADRATIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = f[i] < 0.5f ? 2 * f[i] * f[i] : 1 - 2 * u * u;
+        }
+        break;
+    case EASE_IN_CUBIC:
+        for (size_t i = 0; i < count; i++) f[i] = f[i] * f[i] * f[i];
+        break;
+    case EASE_OUT_CUBIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = 1 - u * u * u;
+        }
+        break;
+    case EASE_INOUT_CUBIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = f[i] < 0.5f ? 4 * f[i] * f[i] * f[i] : 1 - 4 * u * u * u;
+        }
+        break;
+    case EASE_IN_QUARTIC:
+        for (size_t i = 0; i < count; i++) f[i] = f[i] * f[i] * f[i] * f[i];
+        break;
+    case EASE_OUT_QUARTIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = 1 - u * u * u * u;
+        }
+        break;
+    case EASE_INOUT_QUARTIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = f[i] < 0.5f ? 8 * f[i] * f[i] * f[i] * f[i] : 1 - 8 * u * u * u * u;
+        }
+        break;
+    case EASE_IN_QUINTIC:
+        for (size_t i = 0; i < count; i++) f[i] = f[i] * f[i] * f[i] * f[i] * f[i];
+        break;
+    case EASE_OUT_QUINTIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = 1 - u * u * u * u * u;
+        }
+        break;
+    case EASE_INOUT_QUINTIC:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = f[i] < 0.5f ? 16 * f[i] * f[i] * f[i] * f[i] * f[i] : 1 - 16 * u * u * u * u * u;
+        }
+        break;
+    case EASE_IN_SINE:
+        for (size_t i = 0; i < count; i++) f[i] = 1 - cosf(f[i] * halfPi);
+        break;
+    case EASE_OUT_SINE:
+        for (size_t i = 0; i < count; i++) f[i] = sinf(f[i] * halfPi);
+        break;
+    case EASE_INOUT_SINE:
+        for (size_t i = 0; i < count; i++) f[i] = (1 - cosf(f[i] * pi)) / 2;
+        break;
+    case EASE_IN_EXPONENTIAL:
+        for (size_t i = 0; i < count; i++) f[i] = exp2f(10 * f[i] - 10);
+        break;
+    case EASE_OUT_EXPONENTIAL:
+        for (size_t i = 0; i < count; i++) f[i] = 1 - exp2f(-10 * f[i]);
+        break;
+    case EASE_INOUT_EXPONENTIAL:
+        for (size_t i = 0; i < count; i++) {
+            f[i] = f[i] < 0.5f ? exp2f(20 * f[i] - 10) / 2 : 1 - exp2f(10 - 20 * f[i]) / 2;
+        }
+        break;
+    case EASE_IN_CIRCULAR:
+        for (size_t i = 0; i < count; i++) f[i] = 1 - sqrtf(std::max(0.0f, 1 - f[i] * f[i]));
+        break;
+    case EASE_OUT_CIRCULAR:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = sqrtf(std::max(0.0f, 1 - u * u));
+        }
+        break;
+    case EASE_INOUT_CIRCULAR:
+        for (size_t i = 0; i < count; i++) {
+            float u = 1 - f[i];
+            f[i] = f[i] < 0.5f ? (1 - sqrtf(std::max(0.0f, 1 - 4 * f[i] * f[i]))) / 2
+                               : (1 + sqrtf(std::max(0.0f, 1 - 4 * u * u))) / 2;
+        }
+        break;
+    case LINEAR:
+    default:
+        break;
+    }
+}
+
 double Tween::linear(double t, double d, double b, double c)
 {
     if(d == 0) return b;
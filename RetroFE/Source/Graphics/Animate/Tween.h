@@ -16,10 +16,13 @@
 #pragma once
 
 #include "TweenTypes.h"
+#include "../ViewInfo.h"
+#include "../../Utility/Interner.h"
+#include <algorithm>
 #include <string>
+#include <string_view>
 #include <map>
-
-class ViewInfo;
+#include <vector>
 
 class Tween
 {
@@ -28,13 +31,28 @@ public:
     Tween(TweenProperty name, TweenAlgorithm type, double start, double end, double duration, const std::string& playlistFilter = "");
     float animate(double elapsedTime) const;
     float animate(double elapsedTime, double startValue) const;
+
+    // Writes the value at elapsedTime into the tweened property of info; tweens without a
+    // start value continue from the property in startInfo
+    void apply(ViewInfo &info, const ViewInfo &startInfo, double elapsedTime) const;
+
+    // True when the tween has no playlist filter, no playlist is set (-1) or the filter lists playlistId
+    bool matchesPlaylist(int playlistId) const
+    {
+        return playlistIds_.empty() || playlistId < 0 ||
+               std::find(playlistIds_.begin(), playlistIds_.end(), playlistId) != playlistIds_.end();
+    }
+
     static float animateSingle(TweenAlgorithm type, double start, double end, double duration, double elapsedTime);
+    // Maps count fractions of the duration (0..1) in place to eased fractions of the distance
+    static void easeBatch(TweenAlgorithm type, float *fractions, size_t count);
     static TweenAlgorithm getTweenType(std::string name);
     static bool getTweenProperty(std::string name, TweenProperty &property);
+    // Id of a playlist name as matched by playlist filters; -1 for no playlist
+    static int playlistId(std::string_view name);
     TweenProperty property;
     double duration;
     bool   startDefined{ true };
-    std::string playlistFilter;
 
 private:
     static double easeInQuadratic(double elapsedTime, double duration, double b, double c);
@@ -62,7 +80,24 @@ private:
 
     static std::map<std::string, TweenAlgorithm, std::less<>> tweenTypeMap_;
     static std::map<std::string, TweenProperty, std::less<>> tweenPropertyMap_;
+    static Interner playlists_;
+
+    // What apply() writes, resolved from property once at construction
+    enum Target
+    {
+        TargetFloat,
+        TargetLayer,
+        TargetMonitor,
+        TargetRestart,
+        TargetNone
+    };
+
+    friend class TweenSet;
+
     TweenAlgorithm type;
     double start;
     double end;
+    Target target_;
+    float ViewInfo::*field_{ nullptr };
+    std::vector<int> playlistIds_;
 };
@@ -14,6 +14,7 @@
  * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "TweenSet.h"
+#include <algorithm>
 
 TweenSet::TweenSet() = default;
 
@@ -22,6 +23,7 @@ TweenSet::TweenSet(const TweenSet& copy) {
     for (const auto& tween : copy.set_) {
         set_.push_back(std::make_unique<Tween>(*tween));
     }
+    compile();
 }
 
 TweenSet& TweenSet::operator=(const TweenSet& other) {
@@ -31,6 +33,7 @@ TweenSet& TweenSet::operator=(const TweenSet& other) {
         for (const auto& tween : other.set_) {
             set_.push_back(std::make_unique<Tween>(*tween));
         }
+        compile();
     }
     return *this;
 }
@@ -43,10 +46,12 @@ TweenSet::~TweenSet()
 
 void TweenSet::push(std::unique_ptr<Tween> tween) {
     set_.push_back(std::move(tween));
+    compile();
 }
 
 void TweenSet::clear() {
     set_.clear();
+    compile();
 }
 
 Tween* TweenSet::getTween(unsigned int index) const {
@@ -61,3 +66,90 @@ size_t TweenSet::size() const
 {
     return set_.size();
 }
+
+
+void TweenSet::compile()
+{
+    runs_.clear();
+    tween_.clear();
+    from_.clear();
+    to_.clear();
+    duration_.clear();
+    invDuration_.clear();
+    endFraction_.clear();
+    batchIndex_.assign(set_.size(), -1);
+
+    std::vector<unsigned int> order;
+    for (unsigned int i = 0; i < set_.size(); i++) {
+        if (set_[i]->target_ == Tween::TargetFloat) {
+            order.push_back(i);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [this](unsigned int a, unsigned int b) {
+        return set_[a]->type < set_[b]->type;
+    });
+
+    for (unsigned int i : order) {
+        const Tween &tween = *set_[i];
+        if (runs_.empty() || runs_.back().algorithm != tween.type) {
+            runs_.push_back({ tween.type, tween_.size(), tween_.size() });
+        }
+        runs_.back().end++;
+        batchIndex_[i] = static_cast<int>(tween_.size());
+        tween_.push_back(i);
+        from_.push_back(static_cast<float>(tween.start));
+        to_.push_back(static_cast<float>(tween.end));
+        duration_.push_back(static_cast<float>(tween.duration));
+        invDuration_.push_back(tween.duration > 0 ? static_cast<float>(1.0 / tween.duration) : 0.0f);
+        endFraction_.push_back(tween.duration > 0 ? 1.0f : 0.0f);
+    }
+}
+
+
+bool TweenSet::apply(ViewInfo &info, const ViewInfo &startInfo, double elapsedTime, int playlistId) const
+{
+    // Scratch per thread: sets are shared by components updated on different threads
+    thread_local std::vector<float> fraction;
+    thread_local std::vector<float> from;
+    size_t count = tween_.size();
+    if (fraction.size() < count) {
+        fraction.resize(count);
+        from.resize(count);
+    }
+
+    // Fraction of the duration, exactly 1 once it has passed so tweens end on their value
+    // (a zero duration keeps the from value, as Tween::animate does)
+    float elapsed = static_cast<float>(elapsedTime);
+    for (size_t i = 0; i < count; i++) {
+        fraction[i] = elapsed < duration_[i] ? elapsed * invDuration_[i] : endFraction_[i];
+    }
+    for (const Run &run : runs_) {
+        Tween::easeBatch(run.algorithm, &fraction[run.begin], run.end - run.begin);
+    }
+
+    // Tweens without a from value continue from where the property was
+    for (size_t i = 0; i < count; i++) {
+        const Tween &tween = *set_[tween_[i]];
+        from[i] = tween.startDefined ? from_[i] : startInfo.*tween.field_;
+    }
+    for (size_t i = 0; i < count; i++) {
+        from[i] = from[i] * (1 - fraction[i]) + to_[i] * fraction[i];
+    }
+
+    // Write back in set order, so a later tween of the same property still wins
+    bool done = true;
+    for (size_t i = 0; i < set_.size(); i++) {
+        const Tween &tween = *set_[i];
+        if (!tween.matchesPlaylist(playlistId)) continue;
+
+        if (elapsedTime < tween.duration)
+            done = false;
+
+        int batched = batchIndex_[i];
+        if (batched >= 0)
+            info.*tween.field_ = from[batched];
+        else
+            tween.apply(info, startInfo, std::min(elapsedTime, tween.duration));
+    }
+    return done;
+}
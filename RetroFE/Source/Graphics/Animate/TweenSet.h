@@ -32,6 +32,29 @@ public:
 
     size_t size() const;
 
+    // Animates every tween that matches playlistId to elapsedTime and writes the results
+    // into info, in set order; returns true when all of them have run their full duration
+    bool apply(ViewInfo &info, const ViewInfo &startInfo, double elapsedTime, int playlistId) const;
+
 private:
+    void compile();
+
     std::vector<std::unique_ptr<Tween>> set_;
+
+    // Float properties as structure of arrays, sorted into runs of the same algorithm so
+    // each run is eased by one loop
+    struct Run
+    {
+        TweenAlgorithm algorithm;
+        size_t begin;
+        size_t end;
+    };
+    std::vector<Run> runs_;
+    std::vector<unsigned int> tween_;  // index into set_ of each batched tween
+    std::vector<float> from_;
+    std::vector<float> to_;
+    std::vector<float> duration_;
+    std::vector<float> invDuration_;   // 0 for a zero duration
+    std::vector<float> endFraction_;   // fraction once the duration has passed
+    std::vector<int> batchIndex_;      // per set_ entry, -1 when evaluated by Tween::apply
 };
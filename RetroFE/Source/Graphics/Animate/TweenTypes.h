@@ -67,3 +67,44 @@ enum TweenProperty
     TWEEN_PROPERTY_NOP,
     TWEEN_PROPERTY_RESTART
 };
+
+// Events a layout can attach animations to (onEnter, onMenuScroll, ...)
+enum AnimationEvent
+{
+    EVENT_NONE = -1,
+    EVENT_ENTER,
+    EVENT_EXIT,
+    EVENT_IDLE,
+    EVENT_MENU_IDLE,
+    EVENT_MENU_SCROLL,
+    EVENT_HIGHLIGHT_ENTER,
+    EVENT_HIGHLIGHT_EXIT,
+    EVENT_MENU_ENTER,
+    EVENT_MENU_EXIT,
+    EVENT_GAME_ENTER,
+    EVENT_GAME_EXIT,
+    EVENT_PLAYLIST_ENTER,
+    EVENT_PLAYLIST_EXIT,
+    EVENT_PLAYLIST_NEXT_ENTER,
+    EVENT_PLAYLIST_NEXT_EXIT,
+    EVENT_PLAYLIST_PREV_ENTER,
+    EVENT_PLAYLIST_PREV_EXIT,
+    EVENT_MENU_JUMP_ENTER,
+    EVENT_MENU_JUMP_EXIT,
+    EVENT_ATTRACT_ENTER,
+    EVENT_ATTRACT,
+    EVENT_ATTRACT_EXIT,
+    EVENT_JUKEBOX_JUMP,
+    EVENT_GAME_INFO_ENTER,
+    EVENT_GAME_INFO_EXIT,
+    EVENT_COLLECTION_INFO_ENTER,
+    EVENT_COLLECTION_INFO_EXIT,
+    EVENT_BUILD_INFO_ENTER,
+    EVENT_BUILD_INFO_EXIT,
+    EVENT_MENU_ACTION_INPUT_ENTER,
+    EVENT_MENU_ACTION_INPUT_EXIT,
+    EVENT_MENU_ACTION_SELECT_ENTER,
+    EVENT_MENU_ACTION_SELECT_EXIT,
+    // leave EVENT_COUNT at the end
+    EVENT_COUNT
+};
@@ -28,8 +28,9 @@ Component::Component(Page &p)
     animationDoneRemove_      = false;
     id_                       = -1;
     backgroundTexture_ = nullptr;
-    animationRequestedType_ = "";
-    animationType_ = "";
+    backgroundRequested_ = false;
+    animationRequestedType_ = EVENT_NONE;
+    animationType_ = EVENT_NONE;
     animationRequested_ = false;
     newItemSelected = false;
     newScrollItemSelected = false;
@@ -47,8 +48,8 @@ Component::~Component() = default;
 
 void Component::freeGraphicsMemory()
 {
-    animationRequestedType_ = "";
-    animationType_ = "";
+    animationRequestedType_ = EVENT_NONE;
+    animationType_ = EVENT_NONE;
     animationRequested_ = false;
     newItemSelected = false;
     newScrollItemSelected = false;
@@ -59,12 +60,10 @@ void Component::freeGraphicsMemory()
     currentTweenComplete_ = true;
     elapsedTweenTime_ = 0;
 
+    backgroundRequested_ = false;
     if (backgroundTexture_)
     {
-        SDL_LockMutex(SDL::getMutex());
-        SDL_DestroyTexture(backgroundTexture_);
-        SDL_UnlockMutex(SDL::getMutex());
-        
+        SDL::destroyTexture(backgroundTexture_);
         backgroundTexture_ = nullptr;
     }
  
@@ -72,6 +71,15 @@ void Component::freeGraphicsMemory()
 
 // used to draw lines in the layout using <container>
 void Component::allocateGraphicsMemory()
+{
+    backgroundRequested_ = true;
+    if (SDL::isRenderThread()) {
+        createBackgroundTexture();
+    }
+}
+
+
+void Component::createBackgroundTexture()
 {
     if (!backgroundTexture_) {
         // make a 4x4 pixel wide surface to be stretched during rendering, make it a white background so we can use
@@ -79,9 +87,7 @@ void Component::allocateGraphicsMemory()
         SDL_Surface* surface = SDL_CreateRGBSurface(0, 4, 4, 32, 0, 0, 0, 0);
         SDL_FillRect(surface, nullptr, SDL_MapRGB(surface->format, 255, 255, 255));
 
-        SDL_LockMutex(SDL::getMutex());
         backgroundTexture_ = SDL_CreateTextureFromSurface(SDL::getRenderer(baseViewInfo.Monitor), surface);
-        SDL_UnlockMutex(SDL::getMutex());
 
         SDL_FreeSurface(surface);
         SDL_SetTextureBlendMode(backgroundTexture_, SDL_BLENDMODE_BLEND);
@@ -99,16 +105,16 @@ void Component::initializeFonts()
 }
 
 
-void Component::triggerEvent(const std::string_view& event, int menuIndex)
+void Component::triggerEvent(AnimationEvent event, int menuIndex)
 {
     animationRequestedType_ = event;
     animationRequested_     = true;
     menuIndex_              = (menuIndex > 0 ? menuIndex : 0);
 }
 
-void Component::setPlaylist(const std::string_view& name)
+void Component::setPlaylist(int playlistId)
 {
-    this->playlistName = name;
+    this->playlistId = playlistId;
 }
 
 void Component::setNewItemSelected()
@@ -128,17 +134,17 @@ void Component::setId( int id )
 
 bool Component::isIdle() const
 {
-    return (currentTweenComplete_ || animationType_ == "idle" || animationType_ == "menuIdle" || animationType_ == "attract");
+    return (currentTweenComplete_ || animationType_ == EVENT_IDLE || animationType_ == EVENT_MENU_IDLE || animationType_ == EVENT_ATTRACT);
 }
 
 bool Component::isAttractIdle() const
 {
-    return (currentTweenComplete_ || animationType_ == "idle" || animationType_ == "menuIdle");
+    return (currentTweenComplete_ || animationType_ == EVENT_IDLE || animationType_ == EVENT_MENU_IDLE);
 }
 
 bool Component::isMenuScrolling() const
 {
-    return (!currentTweenComplete_ && animationType_ == "menuScroll");
+    return (!currentTweenComplete_ && animationType_ == EVENT_MENU_SCROLL);
 }
 
 void Component::setTweens(AnimationEvents *set)
@@ -154,7 +160,7 @@ std::string_view Component::filePath()
 bool Component::update(float dt)
 {
     elapsedTweenTime_ += dt;
-    if (animationRequested_ && animationRequestedType_ != "") {
+    if (animationRequested_ && animationRequestedType_ != EVENT_NONE) {
         Animation* newTweens;
         // Check if this component is part of an active scrolling list
         if (menuIndex_ >= MENU_INDEX_HIGH) {
@@ -182,11 +188,11 @@ bool Component::update(float dt)
     }
 
     if (tweens_ && currentTweenComplete_) {
-        animationType_ = "idle";
-        currentTweens_ = tweens_->getAnimation("idle", menuIndex_);
-        if (currentTweens_ && currentTweens_->size() == 0 && !page.isMenuScrolling())
+        animationType_ = EVENT_IDLE;
+        currentTweens_ = tweens_->getAnimation(EVENT_IDLE, menuIndex_);
+        if ((!currentTweens_ || currentTweens_->size() == 0) && !page.isMenuScrolling())
         {
-            currentTweens_ = tweens_->getAnimation("menuIdle", menuIndex_);
+            currentTweens_ = tweens_->getAnimation(EVENT_MENU_IDLE, menuIndex_);
         }
         currentTweenIndex_ = 0;
         elapsedTweenTime_ = 0;
@@ -207,6 +213,10 @@ bool Component::update(float dt)
 // used to draw lines in the layout using <container>
 void Component::draw()
 {
+    if (backgroundRequested_ && !backgroundTexture_) {
+        createBackgroundTexture();
+    }
+
     if (backgroundTexture_ && baseViewInfo.Alpha > 0.0f) {
         SDL_Rect rect = { 0,0,0,0 };
         rect.h = static_cast<int>(baseViewInfo.ScaledHeight());
@@ -230,190 +240,11 @@ bool Component::animate() {
         completeDone = true;
     }
     else {
-        bool currentDone = true;
         TweenSet* tweens = currentTweens_->tweenSet(currentTweenIndex_);
         if (!tweens) return true; // Additional check for safety
 
-        std::string playlist;
-        bool foundFiltered;
-
-        for (unsigned int i = 0; i < tweens->size(); i++) {
-            Tween const* tween = tweens->getTween(i);
-
-            // only animate if filter matches current playlist or in playlist1,playlist2,playlist3
-            if (!tween->playlistFilter.empty() && !playlistName.empty()) {
-                foundFiltered = false;
-                std::stringstream ss(tween->playlistFilter);
-                while (getline(ss, playlist, ',')) {
-                    if (playlistName == playlist) {
-                        foundFiltered = true;
-                        break;
-                    }
-                }
-                if (!foundFiltered) continue; // didn't find match, skip
-            }
-
-            double elapsedTime = elapsedTweenTime_;
-            if (elapsedTime < tween->duration)
-                currentDone = false;
-            else
-                elapsedTime = tween->duration;
-
-            switch (tween->property) {
-            case TWEEN_PROPERTY_X:
-                if (tween->startDefined)
-                    baseViewInfo.X = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.X = tween->animate(elapsedTime, storeViewInfo_.X);
-                break;
-
-            case TWEEN_PROPERTY_Y:
-                if (tween->startDefined)
-                    baseViewInfo.Y = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Y = tween->animate(elapsedTime, storeViewInfo_.Y);
-                break;
-
-            case TWEEN_PROPERTY_HEIGHT:
-                if (tween->startDefined)
-                    baseViewInfo.Height = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Height = tween->animate(elapsedTime, storeViewInfo_.Height);
-                break;
-
-            case TWEEN_PROPERTY_WIDTH:
-                if (tween->startDefined)
-                    baseViewInfo.Width = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Width = tween->animate(elapsedTime, storeViewInfo_.Width);
-                break;
-
-            case TWEEN_PROPERTY_ANGLE:
-                if (tween->startDefined)
-                    baseViewInfo.Angle = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Angle = tween->animate(elapsedTime, storeViewInfo_.Angle);
-                break;
-
-            case TWEEN_PROPERTY_ALPHA:
-                if (tween->startDefined)
-                    baseViewInfo.Alpha = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Alpha = tween->animate(elapsedTime, storeViewInfo_.Alpha);
-                break;
-
-            case TWEEN_PROPERTY_X_ORIGIN:
-                if (tween->startDefined)
-                    baseViewInfo.XOrigin = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.XOrigin = tween->animate(elapsedTime, storeViewInfo_.XOrigin);
-                break;
-
-            case TWEEN_PROPERTY_Y_ORIGIN:
-                if (tween->startDefined)
-                    baseViewInfo.YOrigin = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.YOrigin = tween->animate(elapsedTime, storeViewInfo_.YOrigin);
-                break;
-
-            case TWEEN_PROPERTY_X_OFFSET:
-                if (tween->startDefined)
-                    baseViewInfo.XOffset = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.XOffset = tween->animate(elapsedTime, storeViewInfo_.XOffset);
-                break;
-
-            case TWEEN_PROPERTY_Y_OFFSET:
-                if (tween->startDefined)
-                    baseViewInfo.YOffset = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.YOffset = tween->animate(elapsedTime, storeViewInfo_.YOffset);
-                break;
-
-            case TWEEN_PROPERTY_FONT_SIZE:
-                if (tween->startDefined)
-                    baseViewInfo.FontSize = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.FontSize = tween->animate(elapsedTime, storeViewInfo_.FontSize);
-                break;
-
-            case TWEEN_PROPERTY_BACKGROUND_ALPHA:
-                if (tween->startDefined)
-                    baseViewInfo.BackgroundAlpha = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.BackgroundAlpha = tween->animate(elapsedTime, storeViewInfo_.BackgroundAlpha);
-                break;
-
-            case TWEEN_PROPERTY_MAX_WIDTH:
-                if (tween->startDefined)
-                    baseViewInfo.MaxWidth = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.MaxWidth = tween->animate(elapsedTime, storeViewInfo_.MaxWidth);
-                break;
-
-            case TWEEN_PROPERTY_MAX_HEIGHT:
-                if (tween->startDefined)
-                    baseViewInfo.MaxHeight = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.MaxHeight = tween->animate(elapsedTime, storeViewInfo_.MaxHeight);
-                break;
-
-            case TWEEN_PROPERTY_LAYER:
-                if (tween->startDefined)
-                    baseViewInfo.Layer = static_cast<unsigned int>(tween->animate(elapsedTime));
-                else
-                    baseViewInfo.Layer = static_cast<unsigned int>(tween->animate(elapsedTime, storeViewInfo_.Layer));
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_X:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerX = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerX = tween->animate(elapsedTime, storeViewInfo_.ContainerX);
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_Y:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerY = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerY = tween->animate(elapsedTime, storeViewInfo_.ContainerY);
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_WIDTH:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerWidth = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerWidth = tween->animate(elapsedTime, storeViewInfo_.ContainerWidth);
-                break;
-
-            case TWEEN_PROPERTY_CONTAINER_HEIGHT:
-                if (tween->startDefined)
-                    baseViewInfo.ContainerHeight = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.ContainerHeight = tween->animate(elapsedTime, storeViewInfo_.ContainerHeight);
-                break;
-
-            case TWEEN_PROPERTY_VOLUME:
-                if (tween->startDefined)
-                    baseViewInfo.Volume = tween->animate(elapsedTime);
-                else
-                    baseViewInfo.Volume = tween->animate(elapsedTime, storeViewInfo_.Volume);
-                break;
-
-            case TWEEN_PROPERTY_MONITOR:
-                if (tween->startDefined)
-                    baseViewInfo.Monitor = static_cast<unsigned int>(tween->animate(elapsedTime));
-                else
-                    baseViewInfo.Monitor = static_cast<unsigned int>(tween->animate(elapsedTime, storeViewInfo_.Monitor));
-                break;
-
-            case TWEEN_PROPERTY_NOP:
-                break;
-            case TWEEN_PROPERTY_RESTART:
-                baseViewInfo.Restart = (tween->duration != 0.0) && (elapsedTime == 0.0);
-                break;
-            }
-        }
+        // only animates tweens whose filter matches the current playlist or in playlist1,playlist2,playlist3
+        bool currentDone = tweens->apply(baseViewInfo, storeViewInfo_, elapsedTweenTime_, playlistId);
 
         if (currentDone) {
             currentTweenIndex_++;
@@ -443,6 +274,13 @@ bool Component::isJukeboxPlaying()
 }
 
 
+// True while a tween is running or pending, i.e. the next update can change what is drawn
+bool Component::isAnimating() const
+{
+    return animationRequested_ || (currentTweens_ && currentTweenIndex_ < currentTweens_->size());
+}
+
+
 void Component::setMenuScrollReload(bool menuScrollReload)
 {
     menuScrollReload_ = menuScrollReload;
@@ -34,8 +34,8 @@ public:
     virtual void allocateGraphicsMemory();
     virtual void deInitializeFonts();
     virtual void initializeFonts();
-    void triggerEvent(const std::string_view& event, int menuIndex = -1);
-    void setPlaylist(const std::string_view& name );
+    void triggerEvent(AnimationEvent event, int menuIndex = -1);
+    void setPlaylist(int playlistId);
     void setNewItemSelected();
     void setNewScrollItemSelected();
     bool isIdle() const;
@@ -50,6 +50,7 @@ public:
     virtual void draw();
     void setTweens(AnimationEvents *set);
     virtual bool isPlaying();
+    virtual bool isAnimating() const;
     virtual bool isJukeboxPlaying();
     virtual void skipForward( ) {};
     virtual void skipBackward( ) {};
@@ -60,6 +61,8 @@ public:
     virtual unsigned long long getCurrent( ) {return 0;};
     virtual unsigned long long getDuration( ) {return 0;};
     virtual bool isPaused( ) {return false;};
+    // Whether the component shows the selected item, which decodes first when videos compete
+    virtual void setSelected( bool selected ) {};
     ViewInfo baseViewInfo;
     std::string collectionName;
     void setMenuScrollReload(bool menuScrollReload);
@@ -71,7 +74,8 @@ public:
     virtual void setText(const std::string& text, int id = -1) {};
     virtual void setImage(const std::string& filePath, int id = -1) {};
     int getId( ) const;
-    std::string playlistName;
+    // Current playlist as a Tween::playlistId(), matched against tween playlist filters
+    int playlistId{ -1 };
     
 
 protected:
@@ -81,17 +85,20 @@ private:
 
     bool animate();
     bool tweenSequencingComplete();
+    void createBackgroundTexture();
 
     AnimationEvents *tweens_;
     Animation *currentTweens_;
+    // Created by the first draw after allocateGraphicsMemory, on the render thread
     SDL_Texture *backgroundTexture_;
+    bool         backgroundRequested_;
     bool         pauseOnScroll_;
     ViewInfo     storeViewInfo_;
     unsigned int currentTweenIndex_;
     bool         currentTweenComplete_;
     float        elapsedTweenTime_;
-    std::string  animationRequestedType_;
-    std::string  animationType_;
+    AnimationEvent animationRequestedType_;
+    AnimationEvent animationType_;
     bool         animationRequested_;
     bool         menuScrollReload_;
     bool         animationDoneRemove_;
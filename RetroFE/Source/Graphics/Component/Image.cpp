@@ -17,6 +17,7 @@
 #include "../ViewInfo.h"
 #include "../../SDL.h"
 #include "../../Utility/Log.h"
+#include "../../Execute/Benchmark.h"
 #if (__APPLE__)
     #include <SDL2_image/SDL_image.h>
 #else
@@ -37,54 +38,71 @@ Image::~Image()
 {
     Component::freeGraphicsMemory();
 
-    SDL_LockMutex(SDL::getMutex());
-    if (texture_ != nullptr) {
-        SDL_DestroyTexture(texture_);
-        texture_ = nullptr;
+    if (surface_ != nullptr) {
+        SDL_FreeSurface(surface_);
+        surface_ = nullptr;
     }
-    SDL_UnlockMutex(SDL::getMutex());
+    SDL::destroyTexture(texture_);
+    texture_ = nullptr;
 }
 
 void Image::freeGraphicsMemory()
 {
     Component::freeGraphicsMemory();
 
-    SDL_LockMutex(SDL::getMutex());
-    if (texture_ != nullptr) {
-        SDL_DestroyTexture(texture_);
-        texture_ = nullptr;
+    if (surface_ != nullptr) {
+        SDL_FreeSurface(surface_);
+        surface_ = nullptr;
     }
-    SDL_UnlockMutex(SDL::getMutex());
+    SDL::destroyTexture(texture_);
+    texture_ = nullptr;
 }
 
 void Image::allocateGraphicsMemory()
 {
-    int width;
-    int height;
-
-    if(!texture_) {
-        SDL_LockMutex(SDL::getMutex());
-        texture_ = IMG_LoadTexture(SDL::getRenderer(baseViewInfo.Monitor), file_.c_str());
-        if (!texture_ && altFile_ != "") {
-            texture_ = IMG_LoadTexture(SDL::getRenderer(baseViewInfo.Monitor), altFile_.c_str());
+    decode();
+    if (!texture_ && surface_ && SDL::isRenderThread()) {
+        uploadTexture();
+    }
+
+    Component::allocateGraphicsMemory();
+
+}
+
+void Image::decode()
+{
+    if(!texture_ && !surface_) {
+        // Decoding needs no renderer, so it runs on whichever thread allocates
+        Uint64 loadStart = SDL_GetPerformanceCounter();
+        surface_ = IMG_Load(file_.c_str());
+        if (!surface_ && altFile_ != "") {
+            surface_ = IMG_Load(altFile_.c_str());
+        }
+        if (surface_ && Benchmark::isActive()) {
+            Benchmark::textureLoaded(static_cast<double>(SDL_GetPerformanceCounter() - loadStart) / static_cast<double>(SDL_GetPerformanceFrequency()));
         }
 
-        if (texture_ != nullptr) {
-            if (baseViewInfo.Additive) {
-                SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_ADD);
-            }
-            else {
-                SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
-            }
-            SDL_QueryTexture(texture_, nullptr, nullptr, &width, &height);
-            baseViewInfo.ImageWidth  = (float)width;
-            baseViewInfo.ImageHeight = (float)height;
+        if (surface_ != nullptr) {
+            baseViewInfo.ImageWidth  = (float)surface_->w;
+            baseViewInfo.ImageHeight = (float)surface_->h;
         }
-        SDL_UnlockMutex(SDL::getMutex());
     }
+}
 
-    Component::allocateGraphicsMemory();
+void Image::uploadTexture()
+{
+    texture_ = SDL_CreateTextureFromSurface(SDL::getRenderer(baseViewInfo.Monitor), surface_);
+    SDL_FreeSurface(surface_);
+    surface_ = nullptr;
 
+    if (texture_ != nullptr) {
+        if (baseViewInfo.Additive) {
+            SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_ADD);
+        }
+        else {
+            SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+        }
+    }
 }
 
 std::string_view Image::filePath()
@@ -96,6 +114,10 @@ void Image::draw()
 {
     Component::draw();
 
+    if (!texture_ && surface_) {
+        uploadTexture();
+    }
+
     if(texture_ && baseViewInfo.Alpha > 0.0f) {
         SDL_Rect rect = { 0, 0, 0, 0 };
 
@@ -26,11 +26,17 @@ public:
     ~Image() override;
     void freeGraphicsMemory() override;
     void allocateGraphicsMemory() override;
+    // Decodes the file into surface_ if nothing is loaded yet; safe on any thread
+    void decode();
     void draw() override;
     std::string_view filePath() override;
 
 protected:
+    void uploadTexture();
+
     SDL_Texture* texture_{ nullptr };
+    // Decoded by allocateGraphicsMemory on any thread, uploaded on the render thread
+    SDL_Surface* surface_{ nullptr };
     std::string  file_;
     std::string  altFile_;
 };
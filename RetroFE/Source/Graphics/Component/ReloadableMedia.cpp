@@ -25,6 +25,7 @@
 #include "../../Utility/Log.h"
 #include "../../Utility/Utils.h"
 #include "../../SDL.h"
+#include <algorithm>
 #include <fstream>
 #include <vector>
 #include <iostream>
@@ -50,6 +51,9 @@ ReloadableMedia::ReloadableMedia(Configuration& config, bool systemMode, bool la
 
 ReloadableMedia::~ReloadableMedia()
 {
+    if (isVideo_) {
+        VideoFactory::releasePrerolled(this);
+    }
     if (loadedComponent_ != nullptr) {
         delete loadedComponent_;
         loadedComponent_ = nullptr;
@@ -65,11 +69,14 @@ bool ReloadableMedia::update(float dt)
 {
     if (newItemSelected ||
         (newScrollItemSelected && getMenuScrollReload())) {
+        // Only once the selection settles, while scrolling every item would start pipelines
+        bool settled = newItemSelected;
         newItemSelected = false;
         newScrollItemSelected = false;
         Component* foundComponent = reloadTexture();  // Removed the re-declaration here.
         if (foundComponent) {
-            foundComponent->playlistName = page.getPlaylistName();
+            foundComponent->playlistId = page.getPlaylistId();
+            foundComponent->setSelected(displayOffset_ == 0);
             foundComponent->allocateGraphicsMemory();
             baseViewInfo.ImageWidth = foundComponent->baseViewInfo.ImageWidth;
             baseViewInfo.ImageHeight = foundComponent->baseViewInfo.ImageHeight;
@@ -85,6 +92,9 @@ bool ReloadableMedia::update(float dt)
             delete loadedComponent_;
             loadedComponent_ = nullptr;  // Set to nullptr to avoid dangling pointer.
         }
+        if (settled && isVideo_) {
+            prerollNeighbors();
+        }
     }
     else if (loadedComponent_) {
         loadedComponent_->update(dt);
@@ -170,7 +180,7 @@ Component *ReloadableMedia::reloadTexture()
     Component* foundComponent = nullptr;
     if (loadedComponent_ != nullptr && 
         (typeLC.rfind("playlist", 0) == 0 && 
-        page.getPlaylistName() == loadedComponent_->playlistName)
+        page.getPlaylistId() == loadedComponent_->playlistId)
     ) {
         return loadedComponent_;
     }
@@ -409,6 +419,107 @@ Component *ReloadableMedia::reloadTexture()
 }
 
 
+std::string ReloadableMedia::mediaPath(const std::string& collection, const std::string& type, bool systemMode)
+{
+    std::string imagePath;
+    // check the system folder
+    if (layoutMode_) {
+        // check if collection's assets are in a different theme
+        std::string layoutName;
+        config_.getProperty("collections." + collection + ".layout", layoutName);
+        if (layoutName == "") {
+            config_.getProperty(OPTION_LAYOUT, layoutName);
+        }
+        if (commonMode_) {
+            imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
+        }
+        else {
+            imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", collection);
+        }
+        if (systemMode)
+            imagePath = Utils::combinePath(imagePath, "system_artwork");
+        else
+            imagePath = Utils::combinePath(imagePath, "medium_artwork", type);
+    }
+    else {
+        if (commonMode_) {
+            imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
+            if (systemMode)
+                imagePath = Utils::combinePath(imagePath, "system_artwork");
+            else
+                imagePath = Utils::combinePath(imagePath, "medium_artwork", type);
+        }
+        else {
+            config_.getMediaPropertyAbsolutePath(collection, type, systemMode, imagePath);
+        }
+    }
+    return imagePath;
+}
+
+
+std::vector<std::string> ReloadableMedia::videoCandidates(Item* item)
+{
+    std::vector<std::string> candidates;
+    auto add = [this, &candidates](const std::string& collection, const std::string& basename, const std::string& filepath, bool systemMode) {
+        std::string path = filepath.empty() ? mediaPath(collection, type_, systemMode) : filepath;
+        if (!path.empty()) {
+            candidates.push_back(Utils::combinePath(path, basename));
+        }
+    };
+
+    // Same search order as reloadTexture()
+    std::vector<std::string> names = { item->name, item->fullTitle };
+    if (item->cloneof.length() > 0) {
+        names.push_back(item->cloneof);
+    }
+    names.emplace_back("default");
+
+    for (std::string const& basename : names) {
+        add(collectionName, basename, "", false);
+        add(item->collectionInfo->name, basename, "", false);
+        if (item->leaf) {
+            add(item->collectionInfo->name, type_, item->filepath, false);
+        }
+        else {
+            add(item->name, type_, "", true);
+        }
+    }
+    return candidates;
+}
+
+
+void ReloadableMedia::prerollNeighbors()
+{
+    // Only per-item videos, the rest either stays the same or depends on more than the item
+    std::string typeLC = Utils::toLower(type_);
+    bool perItem = !systemMode_ && !jukebox_ && typeLC.rfind("playlist", 0) != 0 &&
+        typeLC != "isfavorite" && typeLC != "ispaused" && typeLC != "islocked";
+
+    // Only the paths are worked out here, probing for the files happens on the thread pool
+    std::vector<std::vector<std::string>> items;
+    int step = page.isLastScrollForward() ? 1 : -1;
+    for (int i = 1; perItem && i <= VideoFactory::getPrerollCount(); ++i) {
+        Item* item = page.getSelectedItem(displayOffset_ + i * step);
+        if (!item) {
+            break;
+        }
+        items.push_back(videoCandidates(item));
+    }
+
+    std::string loaded = loadedComponent_ ? std::string(loadedComponent_->filePath()) : "";
+    size_t count = items.size();
+    VideoFactory::preroll(this, count, [items = std::move(items), loaded](size_t i) {
+        std::string file;
+        for (std::string const& candidate : items[i]) {
+            if (Utils::findMatchingFile(candidate, videoExtensions, file)) {
+                return file != loaded ? file : std::string();
+            }
+        }
+        return std::string();
+    });
+}
+
+
 Component* ReloadableMedia::findComponent(
     const std::string& collection,
     const std::string& type,
@@ -426,37 +537,7 @@ Component* ReloadableMedia::findComponent(
         imagePath = filepath; 
     } 
     else {
-        // check the system folder
-        if (layoutMode_) {
-            // check if collection's assets are in a different theme
-            std::string layoutName;
-            config_.getProperty("collections." + collection + ".layout", layoutName);
-            if (layoutName == "") {
-                config_.getProperty(OPTION_LAYOUT, layoutName);
-            }
-            if (commonMode_) {
-                imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", "_common");
-            }
-            else {
-                imagePath = Utils::combinePath(Configuration::absolutePath, "layouts", layoutName, "collections", collection);
-            }
-            if (systemMode)
-                imagePath = Utils::combinePath(imagePath, "system_artwork");
-            else
-                imagePath = Utils::combinePath(imagePath, "medium_artwork", type);
-        }
-        else {
-            if (commonMode_) {
-                imagePath = Utils::combinePath(Configuration::absolutePath, "collections", "_common" );
-                if (systemMode)
-                    imagePath = Utils::combinePath(imagePath, "system_artwork");
-                else
-                    imagePath = Utils::combinePath(imagePath, "medium_artwork", type);
-            }
-            else {
-                config_.getMediaPropertyAbsolutePath(collection, type, systemMode, imagePath);
-            }
-        }
+        imagePath = mediaPath(collection, type, systemMode);
     }
 
     // if file already loaded, don't load again
@@ -514,6 +595,14 @@ bool ReloadableMedia::isJukeboxPlaying()
 }
 
 
+bool ReloadableMedia::isAnimating() const
+{
+    if ( loadedComponent_ && loadedComponent_->isAnimating( ) )
+        return true;
+    return Component::isAnimating( );
+}
+
+
 void ReloadableMedia::skipForward( )
 {
     if ( jukebox_ && loadedComponent_ )
@@ -37,6 +37,7 @@ public:
     Component* findComponent(const std::string& collection, const std::string& type, const std::string& basename, std::string_view filepath, bool systemMode, bool isVideo);
     void enableTextFallback_(bool value);
     bool isJukeboxPlaying() override;
+    bool isAnimating() const override;
     void skipForward() override;
     void skipBackward() override;
     void skipForwardp() override;
@@ -50,6 +51,11 @@ public:
 
 private:
     Component* reloadTexture();
+    std::string mediaPath(const std::string& collection, const std::string& type, bool systemMode);
+    // Where an item's video may be, as paths without extension in reloadTexture()'s order
+    std::vector<std::string> videoCandidates(Item* item);
+    // Prerolls the videos of the items the selection is moving towards
+    void prerollNeighbors();
     Configuration& config_;
     bool systemMode_;
     bool layoutMode_;
@@ -93,6 +93,17 @@ bool ReloadableScrollingText::update(float dt)
 }
 
 
+bool ReloadableScrollingText::isAnimating( ) const
+{
+    if ( !text_.empty( ) && scrollingSpeed_ != 0.0f ) {
+        // Text that fits and starts at 0 is not scrolled horizontally
+        if ( direction_ != "horizontal" || startPosition_ != 0.0f || textWidth_ > baseViewInfo.Width )
+            return true;
+    }
+    return Component::isAnimating( );
+}
+
+
 void ReloadableScrollingText::allocateGraphicsMemory( )
 {
     Component::allocateGraphicsMemory( );
@@ -255,7 +266,7 @@ void ReloadableScrollingText::reloadTexture( )
               (void)config_.getProperty("collections." + selectedItem->name + ".genre", text );
         }
         else if (type_.rfind( "playlist", 0 ) == 0) {
-            text = playlistName;
+            text = page.getPlaylistName();
         }
         else if (type_ == "firstLetter") {
           text = selectedItem->fullTitle.at(0);
@@ -398,6 +409,9 @@ void ReloadableScrollingText::draw( )
         else                   // If not, use the general font settings
           font = fontInst_;
 
+        // Distance field fonts render a rendition close to the on-screen size
+        font = font->getSizedFont( baseViewInfo.FontSize * page.getScreenScaleByMonitor( baseViewInfo.Monitor ) );
+
         SDL_Texture *t = font->getTexture( );
 
         float imageWidth     = 0;
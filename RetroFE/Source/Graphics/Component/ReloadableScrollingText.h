@@ -27,6 +27,7 @@ public:
     ReloadableScrollingText(Configuration &config, bool systemMode, bool layoutMode, bool menuMode, std::string type, std::string textFormat, std::string singlePrefix, std::string singlePostfix, std::string pluralPrefix, std::string pluralPostfix, std::string alignment, Page &page, int displayOffset, Font *font, std::string direction, float scrollingSpeed, float startPosition, float startTime, float endTime );
     virtual ~ReloadableScrollingText( );
     bool     update(float dt);
+    bool     isAnimating() const override;
     void     draw( );
     void     allocateGraphicsMemory( );
     void     freeGraphicsMemory( );
@@ -57,6 +57,7 @@ ReloadableText::~ReloadableText()
 
 bool ReloadableText::update(float dt)
 {
+    changed_ = false;
     if (newItemSelected ||
        (newScrollItemSelected && getMenuScrollReload()) ||
         type_ == "time" || type_ == "current" || type_ == "duration" || type_ == "isPaused") {
@@ -68,6 +69,11 @@ bool ReloadableText::update(float dt)
     return Component::update(dt);
 }
 
+bool ReloadableText::isAnimating() const
+{
+    return changed_ || Component::isAnimating();
+}
+
 void ReloadableText::allocateGraphicsMemory()
 {
     ReloadTexture();
@@ -166,7 +172,7 @@ void ReloadableText::ReloadTexture()
             }
         }
         else if (type_.rfind( "playlist", 0 ) == 0) {
-            text = playlistName;
+            text = page.getPlaylistName();
         }
         else if (type_ == "firstLetter") {
           text = selectedItem->fullTitle.at(0);
@@ -303,6 +309,10 @@ void ReloadableText::ReloadTexture()
         if (!ss.str().empty()) {
             imageInst_ = new Text(ss.str(), page, fontInst_, baseViewInfo.Monitor);
         }
+        if (ss.str() != text_) {
+            text_    = ss.str();
+            changed_ = true;
+        }
     }
 }
 
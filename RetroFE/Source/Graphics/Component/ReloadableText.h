@@ -28,6 +28,7 @@ public:
     ReloadableText(std::string type, Page &page, Configuration &config, bool systemMode, Font *font, std::string layoutKey, std::string timeFormat, std::string textFormat, std::string singlePrefix, std::string singlePostfix, std::string pluralPrefix, std::string pluralPostfix);
     virtual ~ReloadableText();
     bool     update(float dt);
+    bool     isAnimating() const override;
     void     draw();
     void     freeGraphicsMemory();
     void     allocateGraphicsMemory();
@@ -50,4 +51,6 @@ private:
     std::string singlePostfix_;
     std::string pluralPrefix_;
     std::string pluralPostfix_;
+    std::string text_;
+    bool changed_{ false };
 };
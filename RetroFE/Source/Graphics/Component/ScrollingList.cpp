@@ -44,6 +44,7 @@
 #include <cctype>
 #include <iomanip>
 #include <algorithm>
+#include <limits>
 
 ScrollingList::ScrollingList( Configuration &c,
                               Page          &p,
@@ -210,6 +211,15 @@ void ScrollingList::setPoints( std::vector<ViewInfo *> *scrollPoints, std::vecto
     scrollPoints_ = scrollPoints;
     tweenPoints_  = tweenPoints;
 
+    // Every point gets its menuScroll slot now, resetTweens() only refills it while the
+    // update threads scroll, so the tables are not changed under them
+    if ( tweenPoints_ ) {
+        for ( AnimationEvents* sets : *tweenPoints_ ) {
+            if ( sets && !sets->getAnimation( EVENT_MENU_SCROLL ) )
+                sets->setAnimation( EVENT_MENU_SCROLL, -1, new Animation( ) );
+        }
+    }
+
     // empty out the list as we will resize it
     components_.clear( );
 
@@ -488,112 +498,112 @@ void ScrollingList::freeGraphicsMemory( )
 
 void ScrollingList::triggerEnterEvent( )
 {
-    triggerEventOnAll("enter", 0);
+    triggerEventOnAll(EVENT_ENTER, 0);
 }
 
 void ScrollingList::triggerExitEvent( )
 {
-    triggerEventOnAll("exit", 0);
+    triggerEventOnAll(EVENT_EXIT, 0);
 }
 
 void ScrollingList::triggerMenuEnterEvent( int menuIndex )
 {
-    triggerEventOnAll("menuEnter", menuIndex);
+    triggerEventOnAll(EVENT_MENU_ENTER, menuIndex);
 }
 
 void ScrollingList::triggerMenuExitEvent( int menuIndex )
 {
-    triggerEventOnAll("menuExit", menuIndex);
+    triggerEventOnAll(EVENT_MENU_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerGameEnterEvent( int menuIndex )
 {
-    triggerEventOnAll("gameEnter", menuIndex);
+    triggerEventOnAll(EVENT_GAME_ENTER, menuIndex);
 }
 
 void ScrollingList::triggerGameExitEvent( int menuIndex )
 {
-    triggerEventOnAll("gameExit", menuIndex);
+    triggerEventOnAll(EVENT_GAME_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerHighlightEnterEvent( int menuIndex )
 {
-    triggerEventOnAll("highlightEnter", menuIndex);
+    triggerEventOnAll(EVENT_HIGHLIGHT_ENTER, menuIndex);
 }
 
 void ScrollingList::triggerHighlightExitEvent( int menuIndex )
 {
-    triggerEventOnAll("highlightExit", menuIndex);
+    triggerEventOnAll(EVENT_HIGHLIGHT_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerPlaylistEnterEvent( int menuIndex )
 {
-    triggerEventOnAll("playlistEnter", menuIndex);
+    triggerEventOnAll(EVENT_PLAYLIST_ENTER, menuIndex);
 }
 
 void ScrollingList::triggerPlaylistExitEvent( int menuIndex )
 {
-    triggerEventOnAll("playlistExit", menuIndex);
+    triggerEventOnAll(EVENT_PLAYLIST_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerMenuJumpEnterEvent( int menuIndex )
 {
-    triggerEventOnAll("menuJumpEnter", menuIndex);
+    triggerEventOnAll(EVENT_MENU_JUMP_ENTER, menuIndex);
 }
 
 void ScrollingList::triggerMenuJumpExitEvent( int menuIndex )
 {
-    triggerEventOnAll("menuJumpExit", menuIndex);
+    triggerEventOnAll(EVENT_MENU_JUMP_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerAttractEnterEvent( int menuIndex )
 {
-    triggerEventOnAll("attractEnter", menuIndex);
+    triggerEventOnAll(EVENT_ATTRACT_ENTER, menuIndex);
 }
 
 void ScrollingList::triggerAttractEvent( int menuIndex )
 {
-    triggerEventOnAll("attract", menuIndex);
+    triggerEventOnAll(EVENT_ATTRACT, menuIndex);
 }
 
 void ScrollingList::triggerAttractExitEvent( int menuIndex )
 {
-    triggerEventOnAll("attractExit", menuIndex);
+    triggerEventOnAll(EVENT_ATTRACT_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerGameInfoEnter(int menuIndex)
 {
-    triggerEventOnAll("gameInfoEnter", menuIndex);
+    triggerEventOnAll(EVENT_GAME_INFO_ENTER, menuIndex);
 }
 void ScrollingList::triggerGameInfoExit(int menuIndex)
 {
-    triggerEventOnAll("gameInfoExit", menuIndex);
+    triggerEventOnAll(EVENT_GAME_INFO_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerCollectionInfoEnter(int menuIndex)
 {
-    triggerEventOnAll("collectionInfoEnter", menuIndex);
+    triggerEventOnAll(EVENT_COLLECTION_INFO_ENTER, menuIndex);
 }
 void ScrollingList::triggerCollectionInfoExit(int menuIndex)
 {
-    triggerEventOnAll("collectionInfoExit", menuIndex);
+    triggerEventOnAll(EVENT_COLLECTION_INFO_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerBuildInfoEnter(int menuIndex)
 {
-    triggerEventOnAll("buildInfoEnter", menuIndex);
+    triggerEventOnAll(EVENT_BUILD_INFO_ENTER, menuIndex);
 }
 void ScrollingList::triggerBuildInfoExit(int menuIndex)
 {
-    triggerEventOnAll("buildInfoExit", menuIndex);
+    triggerEventOnAll(EVENT_BUILD_INFO_EXIT, menuIndex);
 }
 
 void ScrollingList::triggerJukeboxJumpEvent( int menuIndex )
 {
-    triggerEventOnAll("jukeboxJump", menuIndex);
+    triggerEventOnAll(EVENT_JUKEBOX_JUMP, menuIndex);
 }
 
-void ScrollingList::triggerEventOnAll(const std::string& event, int menuIndex)
+void ScrollingList::triggerEventOnAll(AnimationEvent event, int menuIndex)
 {
     size_t componentSize = components_.size();
     for (size_t i = 0; i < componentSize; ++i) {
@@ -616,7 +626,8 @@ bool ScrollingList::update(float dt)
     for (unsigned int i = 0; i < scrollPointsSize; i++) {
         Component *c = components_[i];
         if (c) {
-            c->playlistName = playlistName;
+            c->playlistId = playlistId;
+            c->setSelected(i == selectedOffsetIndex_);
             done &= c->update(dt);
         }
     }
@@ -656,7 +667,9 @@ void ScrollingList::resetTweens(Component* c, AnimationEvents* sets, ViewInfo* c
 
     c->setTweens(sets);
 
-    Animation* scrollTween = sets->getAnimation("menuScroll");
+    // Created by setPoints()
+    Animation* scrollTween = sets->getAnimation(EVENT_MENU_SCROLL);
+    if (!scrollTween) return;
     scrollTween->Clear();
     c->baseViewInfo = *currentViewInfo;
 
@@ -981,6 +994,16 @@ void ScrollingList::draw(unsigned int layer)
     }
 }
 
+unsigned int ScrollingList::lowestLayer() const
+{
+    unsigned int lowest = std::numeric_limits<unsigned int>::max();
+    for ( Component const *c : components_ ) {
+        if ( c && c->baseViewInfo.Layer < lowest ) lowest = c->baseViewInfo.Layer;
+    }
+
+    return lowest;
+}
+
 bool ScrollingList::isScrollingListIdle()
 {
     size_t componentSize = components_.size();
@@ -994,6 +1017,17 @@ bool ScrollingList::isScrollingListIdle()
     return true;
 }
 
+bool ScrollingList::isAnimating() const
+{
+    if ( Component::isAnimating(  ) ) return true;
+
+    for ( Component const *c : components_ ) {
+        if ( c && c->isAnimating(  ) ) return true;
+    }
+
+    return false;
+}
+
 bool ScrollingList::isScrollingListAttractIdle()
 {
     size_t componentSize = components_.size();
@@ -1074,7 +1108,7 @@ void ScrollingList::scroll(bool forward)
             component->allocateGraphicsMemory();
             resetTweens(component, nextTweenPoint, currentScrollPoint, nextScrollPoint, scrollPeriod_);
             component->baseViewInfo.font = nextScrollPoint->font;
-            component->triggerEvent("menuScroll");
+            component->triggerEvent(EVENT_MENU_SCROLL);
         }
     }
 
@@ -71,7 +71,7 @@ public:
     void triggerBuildInfoEnter(int menuIndex = -1);
     void triggerBuildInfoExit(int menuIndex = -1);
     void triggerJukeboxJumpEvent(int menuIndex = -1);
-    void triggerEventOnAll(const std::string& event, int menuIndex);;
+    void triggerEventOnAll(AnimationEvent event, int menuIndex);
 
     bool allocateTexture(size_t index, const Item* i);
     void buildPaths(std::string& imagePath, std::string& videoPath, const std::string& base, const std::string& subPath, const std::string& mediaType, const std::string& videoType);
@@ -98,6 +98,7 @@ public:
     void random();
     bool isScrollingListIdle();
     bool isScrollingListAttractIdle();
+    bool isAnimating() const override;
     size_t getScrollOffsetIndex() const;
     void setScrollOffsetIndex(size_t index);
     void setSelectedIndex(int selectedIndex);
@@ -108,6 +109,8 @@ public:
     void freeGraphicsMemory() override;
     bool update(float dt) override;
     void draw(unsigned int layer);
+    // Lowest layer any scroll point draws on, UINT_MAX when there are none
+    unsigned int lowestLayer() const;
     void setScrollAcceleration(float value);
     void setStartScrollTime(float value);
     void setMinScrollTime(float value);
@@ -153,4 +156,4 @@ private:
     std::vector<Item*>* items_{ nullptr };
     std::vector<Component*> components_;
 
-};
\ No newline at end of file
+};
\ No newline at end of file
@@ -59,6 +59,9 @@ void Text::draw( )
     else                     // If not, use the general font settings
       font = fontInst_;
 
+    // Distance field fonts render a rendition close to the on-screen size
+    font = font->getSizedFont( baseViewInfo.FontSize * page.getScreenScaleByMonitor( baseViewInfo.Monitor ) );
+
     SDL_Texture *t = font->getTexture( );
 
     float imageHeight = 0;
@@ -19,9 +19,9 @@
 #include "../../Database/Configuration.h"
 #include "../../Utility/Log.h"
 #include "../../Utility/Utils.h"
-#include "../../Video/GStreamerVideo.h"
 #include "../../Video/VideoFactory.h"
 #include "../../SDL.h"
+#include <algorithm>
 #include <string>
 
 VideoComponent::VideoComponent(Page &p, const std::string& videoFile, int monitor, int numLoops)
@@ -43,7 +43,7 @@ VideoComponent::~VideoComponent()
 bool VideoComponent::update(float dt)
 {
     if (videoInst_) {
-        isPlaying_ = ((GStreamerVideo*)(videoInst_))->isPlaying();
+        isPlaying_ = videoInst_->isPlaying();
     }
 
     if (videoInst_ && isPlaying_) {
@@ -64,6 +64,9 @@ bool VideoComponent::update(float dt)
         if (isCurrentlyVisible)
             hasBeenOnScreen_ = true;
 
+        videoInst_->setPriority(!isCurrentlyVisible ? IVideo::PriorityOffscreen :
+            selected_ ? IVideo::PrioritySelected : IVideo::PriorityVisible);
+
         // Handle Pause/Resume based on visibility and PauseOnScroll setting
         if (baseViewInfo.PauseOnScroll && !currentPage_->isMenuFastScrolling()) {
             if (!isCurrentlyVisible && !isPaused()) {
@@ -101,6 +104,9 @@ void VideoComponent::allocateGraphicsMemory()
         }
         if (videoFile_ != "") {
             isPlaying_ = videoInst_->play(videoFile_);
+            if (isPlaying_ && !posterTexture_) {
+                poster_ = PosterCache::load(videoFile_);
+            }
         }
     }
 }
@@ -113,6 +119,10 @@ void VideoComponent::freeGraphicsMemory()
     Component::freeGraphicsMemory();
     if (Logger::isLevelEnabled("DEBUG"))
         LOG_DEBUG("VideoComponent", "Component Freed " + Utils::getFileName(videoFile_));
+
+    poster_.reset();
+    SDL::destroyTexture(posterTexture_);
+    posterTexture_ = nullptr;
     
     if (videoInst_)  {
         delete videoInst_;
@@ -135,9 +145,41 @@ void VideoComponent::draw()
         rect.h = static_cast<int>(baseViewInfo.ScaledHeight());
         rect.w = static_cast<int>(baseViewInfo.ScaledWidth());
 
+        // Decode no bigger than the video ends up on screen
+        int layoutWidth = page.getLayoutWidthByMonitor(baseViewInfo.Monitor);
+        int layoutHeight = page.getLayoutHeightByMonitor(baseViewInfo.Monitor);
+        if (layoutWidth > 0 && layoutHeight > 0) {
+            float scale = std::max(static_cast<float>(SDL::getWindowWidth(baseViewInfo.Monitor)) / static_cast<float>(layoutWidth),
+                                   static_cast<float>(SDL::getWindowHeight(baseViewInfo.Monitor)) / static_cast<float>(layoutHeight));
+            videoInst_->setTargetSize(static_cast<int>(static_cast<float>(rect.w) * scale + 0.5f),
+                                      static_cast<int>(static_cast<float>(rect.h) * scale + 0.5f));
+        }
+
         videoInst_->draw();
         SDL_Texture* texture = videoInst_->getTexture();
 
+        if (texture && (poster_ || posterTexture_)) {
+            // Live frames have taken over
+            poster_.reset();
+            SDL::destroyTexture(posterTexture_);
+            posterTexture_ = nullptr;
+        }
+        else if (!texture && poster_) {
+            if (SDL_Surface* surface = poster_->take()) {
+                // The poster has the video's size, so the layout can place it right away
+                if (baseViewInfo.ImageHeight == 0 && baseViewInfo.ImageWidth == 0) {
+                    baseViewInfo.ImageHeight = static_cast<float>(surface->h);
+                    baseViewInfo.ImageWidth = static_cast<float>(surface->w);
+                }
+                posterTexture_ = SDL_CreateTextureFromSurface(SDL::getRenderer(baseViewInfo.Monitor), surface);
+                SDL_FreeSurface(surface);
+                poster_.reset();
+            }
+        }
+        if (!texture) {
+            texture = posterTexture_;
+        }
+
         if (texture)
         {
             SDL::renderCopy(texture, baseViewInfo.Alpha, nullptr, &rect, baseViewInfo, page.getLayoutWidthByMonitor(baseViewInfo.Monitor), page.getLayoutHeightByMonitor(baseViewInfo.Monitor));
@@ -150,6 +192,15 @@ bool VideoComponent::isPlaying()
     return isPlaying_;
 }
 
+bool VideoComponent::isAnimating() const
+{
+    // A throttled decode sits on its last frame, so it needs no redraws until it runs again
+    if (videoInst_ && (videoInst_->getFrameReady() ||
+        (isPlaying_ && !videoInst_->isPaused() && !videoInst_->isThrottled() && baseViewInfo.Alpha > 0.0f)))
+        return true;
+    return Component::isAnimating();
+}
+
 std::string_view VideoComponent::filePath()
 {
     return videoFile_;
@@ -222,3 +273,9 @@ bool VideoComponent::isPaused( )
     else
         return false;
 }
+
+
+void VideoComponent::setSelected( bool selected )
+{
+    selected_ = selected;
+}
@@ -19,8 +19,10 @@
 #include "../Page.h"
 #include "../../Collection/Item.h"
 #include "../../Video/IVideo.h"
+#include "../../Video/PosterCache.h"
 #include "../../Video/VideoFactory.h"
 #include <SDL2/SDL.h>
+#include <memory>
 #include <string>
 
 class VideoComponent : public Component
@@ -33,6 +35,7 @@ public:
     void freeGraphicsMemory() override;
     void allocateGraphicsMemory() override;
     bool isPlaying() override;
+    bool isAnimating() const override;
     void skipForward( ) override;
     void skipBackward( ) override;
     void skipForwardp( ) override;
@@ -42,14 +45,19 @@ public:
     unsigned long long getCurrent( ) override;
     unsigned long long getDuration( ) override;
     bool isPaused( ) override;
+    void setSelected( bool selected ) override;
     std::string_view filePath() override;
 
 private:
     std::string videoFile_;
     std::string name_;
     IVideo* videoInst_{ nullptr };
+    // Shown until the video's first frame is on screen
+    std::shared_ptr<PosterCache::Poster> poster_;
+    SDL_Texture* posterTexture_{ nullptr };
     bool isPlaying_{ false };
     bool hasBeenOnScreen_{ false };
+    bool selected_{ false };
     int numLoops_;
     int monitor_;
     Page* currentPage_{ nullptr };
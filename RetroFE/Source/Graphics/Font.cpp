@@ -14,7 +14,9 @@
  * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "Font.h"
+#include "ThreadPool.h"
 #include "../SDL.h"
+#include "../Execute/Benchmark.h"
 #include "../Utility/Log.h"
 #include <SDL2/SDL.h>
 #if (__APPLE__)
@@ -22,11 +24,126 @@
 #else
     #include <SDL2/SDL_ttf.h>
 #endif
+#include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 
-Font::Font(std::string fontPath, int fontSize, SDL_Color color, int monitor)
-    : texture(NULL)
+namespace
+{
+    // Distance field fonts are rasterized once at this size, oversampled to
+    // get sub pixel accurate edges. The spread is in reference pixels.
+    const int sdfReferenceSize = 64;
+    const int sdfOversample = 4;
+    const int sdfSpread = 6;
+
+    // Renditions are quantized to steps of 2^(1/8) in on-screen height. Every
+    // rendition drawn within the last second keeps its texture, plus a couple of
+    // spares so a FontSize tween can step back without rendering again.
+    const float sdfStepsPerOctave = 8.0f;
+    const float sdfMinHeight = 6.0f;
+    const float sdfMaxHeight = 256.0f;
+    const Uint32 sdfLiveMs = 1000;
+    const int sdfSpareRenditions = 2;
+
+    // SDL_ttf shares one FreeType library, faces may only be opened and
+    // closed by one thread at a time. Rendering from separate faces is fine.
+    std::mutex ttfMutex;
+
+    TTF_Font *openFont(const std::string &fontPath, int fontSize)
+    {
+        std::lock_guard<std::mutex> lock(ttfMutex);
+        return TTF_OpenFont(fontPath.c_str(), fontSize);
+    }
+
+    void closeFont(TTF_Font *font)
+    {
+        std::lock_guard<std::mutex> lock(ttfMutex);
+        TTF_CloseFont(font);
+    }
+
+    struct SdfPoint
+    {
+        int dx;
+        int dy;
+        int distSq() const { return dx * dx + dy * dy; }
+    };
+
+    const SdfPoint sdfInside = { 0, 0 };
+    const SdfPoint sdfEmpty = { 9999, 9999 };
+
+    void compareSdf(const std::vector<SdfPoint> &grid, int w, int h, SdfPoint &p, int x, int y, int offsetX, int offsetY)
+    {
+        int nx = x + offsetX;
+        int ny = y + offsetY;
+        SdfPoint other = (nx >= 0 && ny >= 0 && nx < w && ny < h) ? grid[ny * w + nx] : sdfEmpty;
+        other.dx += offsetX;
+        other.dy += offsetY;
+        if(other.distSq() < p.distSq()) {
+            p = other;
+        }
+    }
+
+    // Two pass 8-point sequential euclidean distance transform
+    void generateSdf(std::vector<SdfPoint> &grid, int w, int h)
+    {
+        for(int y = 0; y < h; ++y) {
+            for(int x = 0; x < w; ++x) {
+                SdfPoint p = grid[y * w + x];
+                compareSdf(grid, w, h, p, x, y, -1,  0);
+                compareSdf(grid, w, h, p, x, y,  0, -1);
+                compareSdf(grid, w, h, p, x, y, -1, -1);
+                compareSdf(grid, w, h, p, x, y,  1, -1);
+                grid[y * w + x] = p;
+            }
+            for(int x = w - 1; x >= 0; --x) {
+                SdfPoint p = grid[y * w + x];
+                compareSdf(grid, w, h, p, x, y, 1, 0);
+                grid[y * w + x] = p;
+            }
+        }
+        for(int y = h - 1; y >= 0; --y) {
+            for(int x = w - 1; x >= 0; --x) {
+                SdfPoint p = grid[y * w + x];
+                compareSdf(grid, w, h, p, x, y,  1, 0);
+                compareSdf(grid, w, h, p, x, y,  0, 1);
+                compareSdf(grid, w, h, p, x, y, -1, 1);
+                compareSdf(grid, w, h, p, x, y,  1, 1);
+                grid[y * w + x] = p;
+            }
+            for(int x = 0; x < w; ++x) {
+                SdfPoint p = grid[y * w + x];
+                compareSdf(grid, w, h, p, x, y, -1, 0);
+                grid[y * w + x] = p;
+            }
+        }
+    }
+
+    int sdfRenditionHeight(float fontHeight)
+    {
+        fontHeight = std::max(sdfMinHeight, std::min(sdfMaxHeight, fontHeight));
+        float step = std::round(std::log2(fontHeight) * sdfStepsPerOctave);
+        return static_cast<int>(std::lround(std::exp2(step / sdfStepsPerOctave)));
+    }
+
+    int roundDiv(int value, int divisor)
+    {
+        return static_cast<int>(std::lround(static_cast<float>(value) / static_cast<float>(divisor)));
+    }
+}
+
+Font::Font(std::string fontPath, int fontSize, SDL_Color color, int monitor, bool sdf)
+    : atlasFont_(NULL)
+    , sdfFont_(NULL)
+    , sdf_(sdf)
+    , texture(NULL)
+    , atlasSurface_(NULL)
+    , rasterizePending_(false)
+    , rasterizeDone_(false)
+    , height(0)
+    , ascent(0)
+    , textureBytes_(0)
+    , lastUsed_(0)
     , fontPath_(fontPath)
     , fontSize_(fontSize)
     , color_(color)
@@ -34,26 +151,124 @@ Font::Font(std::string fontPath, int fontSize, SDL_Color color, int monitor)
 {
 }
 
+Font::Font(Font *atlasFont, SDL_Color color)
+    : atlasFont_(atlasFont)
+    , sdfFont_(NULL)
+    , sdf_(false)
+    , texture(NULL)
+    , atlasSurface_(NULL)
+    , rasterizePending_(false)
+    , rasterizeDone_(false)
+    , height(0)
+    , ascent(0)
+    , textureBytes_(0)
+    , lastUsed_(0)
+    , fontPath_(atlasFont->fontPath_)
+    , fontSize_(atlasFont->fontSize_)
+    , color_(color)
+    , monitor_(atlasFont->monitor_)
+{
+}
+
+Font::Font(Font *sdfFont, int fontHeight)
+    : atlasFont_(NULL)
+    , sdfFont_(sdfFont)
+    , sdf_(false)
+    , texture(NULL)
+    , atlasSurface_(NULL)
+    , rasterizePending_(false)
+    , rasterizeDone_(false)
+    , height(0)
+    , ascent(0)
+    , textureBytes_(0)
+    , lastUsed_(0)
+    , fontPath_(sdfFont->fontPath_)
+    , fontSize_(fontHeight)
+    , color_(sdfFont->color_)
+    , monitor_(sdfFont->monitor_)
+{
+}
+
 Font::~Font()
 {
-    deInitialize();
+    // The shared atlas is owned and released by its own font
+    if(!atlasFont_) {
+        deInitialize();
+    }
+
+    std::map<int, Font *>::iterator it;
+    for(it = sizedFonts_.begin(); it != sizedFonts_.end(); it++) {
+        delete it->second;
+    }
+    sizedFonts_.clear();
 }
 
 SDL_Texture *Font::getTexture()
 {
-    return texture;
+    Font *owner = atlasFont_ ? atlasFont_ : this;
+
+    // Textures are only created here, on the thread that draws
+    owner->waitRasterized();
+    if(!owner->texture && owner->atlasSurface_) {
+        owner->uploadAtlas();
+    }
+
+    SDL_Texture *t = owner->texture;
+
+    // The atlas is shared between colours, so tint it for every caller
+    if(t) {
+        SDL_SetTextureColorMod(t, color_.r, color_.g, color_.b);
+    }
+    return t;
+}
+
+SDL_Color Font::getColor()
+{
+    return color_;
 }
 
 int Font::getHeight()
 {
+    if(atlasFont_) {
+        return atlasFont_->getHeight();
+    }
+    waitRasterized();
     return height;
 }
 int Font::getAscent()
 {
+    if(atlasFont_) {
+        return atlasFont_->getAscent();
+    }
+    waitRasterized();
     return ascent;
 }
+
+bool Font::isSdf()
+{
+    if(atlasFont_) {
+        return atlasFont_->isSdf();
+    }
+    return sdf_;
+}
+
 bool Font::getRect(unsigned int charCode, GlyphInfo &glyph)
 {
+    if(atlasFont_) {
+        return atlasFont_->getRect(charCode, glyph);
+    }
+
+    waitRasterized();
+
+    if(sdf_) {
+        std::map<unsigned int, SdfGlyph>::iterator sdfIt = sdfGlyphs_.find(charCode);
+        if(sdfIt != sdfGlyphs_.end()) {
+            glyph = sdfIt->second.glyph;
+            return true;
+        }
+        return false;
+    }
+
     std::map<unsigned int, GlyphInfoBuild *>::iterator it = atlas.find(charCode);
 
     if(it != atlas.end()) {
@@ -66,9 +281,177 @@ bool Font::getRect(unsigned int charCode, GlyphInfo &glyph)
     return false;
 }
 
+Font *Font::getSizedFont(float fontHeight)
+{
+    if(atlasFont_) {
+        Font *sized = atlasFont_->getSizedFont(fontHeight);
+        if(sized == atlasFont_) {
+            return this;
+        }
+
+        // Colour handle onto the white rendition
+        Font *&variant = sizedFonts_[sized->fontSize_];
+        if(!variant) {
+            variant = new Font(sized, color_);
+        }
+        return variant;
+    }
+
+    waitRasterized();
+
+    if(!sdf_ || sdfGlyphs_.empty()) {
+        return this;
+    }
+
+    int renditionHeight = sdfRenditionHeight(fontHeight);
+    Font *&sized = sizedFonts_[renditionHeight];
+    if(!sized) {
+        sized = new Font(this, renditionHeight);
+    }
+    Uint32 now = SDL_GetTicks();
+    sized->lastUsed_ = now;
+
+    // Render a missing rendition on the pool, making room among the ones nobody drew lately
+    if(!sized->rasterizePending_ && !sized->texture && !sized->atlasSurface_) {
+        int live = 0;
+        int resident = 0;
+        std::map<int, Font *>::iterator it;
+        for(it = sizedFonts_.begin(); it != sizedFonts_.end(); it++) {
+            if(it->second->texture) {
+                resident++;
+                if(now - it->second->lastUsed_ < sdfLiveMs) {
+                    live++;
+                }
+            }
+        }
+        while(resident >= live + sdfSpareRenditions) {
+            Font *oldest = NULL;
+            for(it = sizedFonts_.begin(); it != sizedFonts_.end(); it++) {
+                Font *rendition = it->second;
+                if(rendition->texture && now - rendition->lastUsed_ >= sdfLiveMs &&
+                   (!oldest || rendition->lastUsed_ < oldest->lastUsed_)) {
+                    oldest = rendition;
+                }
+            }
+            if(!oldest) {
+                break;
+            }
+            oldest->deInitialize();
+            resident--;
+        }
+
+        sized->initializeAsync();
+
+        if(Logger::isLevelEnabled("DEBUG")) {
+            std::stringstream ss;
+            ss << "Rendering " << fontPath_ << " at height " << renditionHeight << " from its distance field, "
+               << resident << " renditions resident, " << live << " of them drawn in the last second";
+            LOG_DEBUG("Font", ss.str());
+        }
+    }
+
+    // Until it is ready draw with the closest rendition that is, the caller scales it
+    if(sized->rasterizePending_ && !sized->rasterizeDone_) {
+        Font *nearest = NULL;
+        float nearestDistance = 0;
+        std::map<int, Font *>::iterator it;
+        for(it = sizedFonts_.begin(); it != sizedFonts_.end(); it++) {
+            Font *rendition = it->second;
+            bool ready = rendition->texture || (rendition->rasterizePending_ ? rendition->rasterizeDone_.load() : rendition->atlasSurface_ != NULL);
+            if(rendition == sized || !ready) {
+                continue;
+            }
+            float distance = std::abs(std::log2(static_cast<float>(rendition->fontSize_) / static_cast<float>(renditionHeight)));
+            if(!nearest || distance < nearestDistance) {
+                nearest = rendition;
+                nearestDistance = distance;
+            }
+        }
+        if(nearest) {
+            nearest->waitRasterized();
+            nearest->lastUsed_ = now;
+            return nearest;
+        }
+    }
+
+    // Nothing to fall back on, the first rendition of a font is waited for
+    sized->waitRasterized();
+    return sized;
+}
+
 bool Font::initialize()
 {
-    TTF_Font *font = TTF_OpenFont(fontPath_.c_str(), fontSize_);
+    if(atlasFont_) {
+        return atlasFont_->initialize();
+    }
+
+    if(sdfFont_) {
+        if(texture || atlasSurface_) {
+            return true;
+        }
+        return sdfFont_->renderSdf(this);
+    }
+
+    waitRasterized();
+
+    if(sdf_) {
+        return initializeSdf();
+    }
+
+    // Several components share a font, only rasterize it once
+    if(texture) {
+        return true;
+    }
+
+    if(!atlasSurface_ && !rasterize()) {
+        return false;
+    }
+
+    return uploadAtlas();
+}
+
+void Font::initializeAsync()
+{
+    if(atlasFont_) {
+        atlasFont_->initializeAsync();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(rasterizeMutex_);
+    if(texture || atlasSurface_ || !sdfGlyphs_.empty() || rasterizePending_) {
+        return;
+    }
+
+    rasterizePending_ = true;
+    rasterizeDone_ = false;
+    rasterized_.run([this]() {
+        rasterize();
+        rasterizeDone_.store(true, std::memory_order_release);
+    });
+}
+
+void Font::waitRasterized()
+{
+    if(!rasterizePending_.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(rasterizeMutex_);
+    rasterized_.wait();
+    rasterizePending_ = false;
+}
+
+bool Font::rasterize()
+{
+    if(sdf_) {
+        return initializeSdf();
+    }
+
+    if(sdfFont_) {
+        return sdfFont_->renderSdf(this);
+    }
+
+    TTF_Font *font = openFont(fontPath_, fontSize_);
 
     if (!font) {
         std::stringstream ss;
@@ -77,24 +460,49 @@ bool Font::initialize()
         return false;
     }
 
-    int x = 0;
-    int y = 0;
-    int atlasHeight = 0;
-    int atlasWidth = 0;
     height = TTF_FontHeight(font);
     ascent = TTF_FontAscent(font);
 
+    // Glyphs are rendered in white, the colour is applied at draw time
+    SDL_Color white = {255, 255, 255, 255};
+
     for(unsigned short int i = 32; i < 128; ++i) {
         GlyphInfoBuild *info = new GlyphInfoBuild;
         memset(info, 0, sizeof(GlyphInfoBuild));
 
-        color_.a = 255;
-        info->surface = TTF_RenderGlyph_Blended(font, i, color_);
+        info->surface = TTF_RenderGlyph_Blended(font, i, white);
         TTF_GlyphMetrics(font, i,
         		&info->glyph.minX, &info->glyph.maxX,
         		&info->glyph.minY, &info->glyph.maxY,
         		&info->glyph.advance);
 
+        atlas[i] = info;
+    }
+
+    closeFont(font);
+
+    if(!packAtlas()) {
+        return false;
+    }
+
+    std::stringstream ss;
+    ss << "Loaded " << fontPath_ << " at size " << fontSize_ << ": " << textureBytes_ << " bytes of glyph atlas";
+    LOG_DEBUG("Font", ss.str());
+
+    return true;
+}
+
+bool Font::packAtlas()
+{
+    int x = 0;
+    int y = 0;
+    int atlasHeight = 0;
+    int atlasWidth = 0;
+
+    std::map<unsigned int, GlyphInfoBuild *>::iterator it;
+    for(it = atlas.begin(); it != atlas.end(); it++) {
+        GlyphInfoBuild *info = it->second;
+
         if(x + info->surface->w >= 1024) {
             atlasHeight += y;
             atlasWidth = (atlasWidth >= x) ? atlasWidth : x;
@@ -106,7 +514,6 @@ bool Font::initialize()
         info->glyph.rect.h = info->surface->h;
         info->glyph.rect.x = x;
         info->glyph.rect.y = atlasHeight;
-        atlas[i] = info;
 
         x += info->glyph.rect.w;
         y = (y > info->glyph.rect.h) ? y : info->glyph.rect.h;
@@ -132,35 +539,246 @@ bool Font::initialize()
 #endif
 
     SDL_Surface *atlasSurface = SDL_CreateRGBSurface(0, atlasWidth, atlasHeight, 32, rmask, gmask, bmask, amask);
-    std::map<unsigned int, GlyphInfoBuild *>::iterator it;
     for(it = atlas.begin(); it != atlas.end(); it++) {
         GlyphInfoBuild *info = it->second;
-        SDL_BlitSurface(info->surface, NULL, atlasSurface, &info->glyph.rect);
+        if(atlasSurface) {
+            SDL_BlitSurface(info->surface, NULL, atlasSurface, &info->glyph.rect);
+        }
         SDL_FreeSurface(info->surface);
         info->surface = NULL;
     }
-    SDL_LockMutex(SDL::getMutex());
 
-    texture = SDL_CreateTextureFromSurface(SDL::getRenderer(monitor_), atlasSurface);
+    atlasSurface_ = atlasSurface;
+    size_t builtBytes = static_cast<size_t>(atlasWidth) * static_cast<size_t>(atlasHeight) * 4;
+    if(Benchmark::isActive()) {
+        Benchmark::fontMemory(static_cast<long long>(builtBytes) - static_cast<long long>(textureBytes_), 0);
+    }
+    textureBytes_ = builtBytes;
+
+    return atlasSurface_ != NULL;
+}
+
+bool Font::uploadAtlas()
+{
+    if(!atlasSurface_) {
+        return false;
+    }
+
+    // Off the render thread the atlas waits for getTexture() on the next draw
+    if(!SDL::isRenderThread()) {
+        return true;
+    }
+
+    texture = SDL_CreateTextureFromSurface(SDL::getRenderer(monitor_), atlasSurface_);
     SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
-    SDL_FreeSurface(atlasSurface);
-    SDL_UnlockMutex(SDL::getMutex());
+    SDL_FreeSurface(atlasSurface_);
+    atlasSurface_ = NULL;
 
-    TTF_CloseFont(font);
+    return texture != NULL;
+}
 
-    return true;
+bool Font::initializeSdf()
+{
+    if(!sdfGlyphs_.empty()) {
+        return true;
+    }
+
+    TTF_Font *font = openFont(fontPath_, sdfReferenceSize * sdfOversample);
+
+    if (!font) {
+        std::stringstream ss;
+        ss << "Could not open font: " << TTF_GetError();
+        LOG_WARNING("FontCache", ss.str());
+        return false;
+    }
+
+    height = roundDiv(TTF_FontHeight(font), sdfOversample);
+    ascent = roundDiv(TTF_FontAscent(font), sdfOversample);
+
+    SDL_Color white = {255, 255, 255, 255};
+    int pad = sdfSpread * sdfOversample;
+    size_t distanceBytes = 0;
+
+    for(unsigned short int i = 32; i < 128; ++i) {
+        SDL_Surface *rendered = TTF_RenderGlyph_Blended(font, i, white);
+        if(!rendered) {
+            continue;
+        }
+        SDL_Surface *surface = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(rendered);
+        if(!surface) {
+            continue;
+        }
+
+        SdfGlyph &sdfGlyph = sdfGlyphs_[i];
+        int minX, maxX, minY, maxY, advance;
+        TTF_GlyphMetrics(font, i, &minX, &maxX, &minY, &maxY, &advance);
+        sdfGlyph.glyph.minX = roundDiv(minX, sdfOversample);
+        sdfGlyph.glyph.maxX = roundDiv(maxX, sdfOversample);
+        sdfGlyph.glyph.minY = roundDiv(minY, sdfOversample);
+        sdfGlyph.glyph.maxY = roundDiv(maxY, sdfOversample);
+        sdfGlyph.glyph.advance = roundDiv(advance, sdfOversample);
+        sdfGlyph.width = (surface->w + sdfOversample - 1) / sdfOversample;
+        sdfGlyph.height = (surface->h + sdfOversample - 1) / sdfOversample;
+        sdfGlyph.glyph.rect.x = 0;
+        sdfGlyph.glyph.rect.y = 0;
+        sdfGlyph.glyph.rect.w = sdfGlyph.width;
+        sdfGlyph.glyph.rect.h = sdfGlyph.height;
+
+        // Distance to the nearest pixel inside and outside the oversampled glyph
+        int gridWidth = (sdfGlyph.width + 2 * sdfSpread) * sdfOversample;
+        int gridHeight = (sdfGlyph.height + 2 * sdfSpread) * sdfOversample;
+        std::vector<SdfPoint> inside(gridWidth * gridHeight, sdfEmpty);
+        std::vector<SdfPoint> outside(gridWidth * gridHeight, sdfInside);
+
+        SDL_LockSurface(surface);
+        for(int y = 0; y < surface->h; ++y) {
+            Uint32 *row = reinterpret_cast<Uint32 *>(static_cast<Uint8 *>(surface->pixels) + y * surface->pitch);
+            for(int x = 0; x < surface->w; ++x) {
+                if((row[x] >> 24) >= 128) {
+                    int index = (y + pad) * gridWidth + x + pad;
+                    inside[index] = sdfInside;
+                    outside[index] = sdfEmpty;
+                }
+            }
+        }
+        SDL_UnlockSurface(surface);
+        SDL_FreeSurface(surface);
+
+        generateSdf(inside, gridWidth, gridHeight);
+        generateSdf(outside, gridWidth, gridHeight);
+
+        // Box filter down to the reference size, positive inside the glyph
+        int fieldWidth = sdfGlyph.width + 2 * sdfSpread;
+        int fieldHeight = sdfGlyph.height + 2 * sdfSpread;
+        sdfGlyph.distance.resize(fieldWidth * fieldHeight);
+        for(int y = 0; y < fieldHeight; ++y) {
+            for(int x = 0; x < fieldWidth; ++x) {
+                float sum = 0;
+                for(int sy = 0; sy < sdfOversample; ++sy) {
+                    for(int sx = 0; sx < sdfOversample; ++sx) {
+                        int index = (y * sdfOversample + sy) * gridWidth + x * sdfOversample + sx;
+                        float d = std::sqrt(static_cast<float>(outside[index].distSq())) -
+                                  std::sqrt(static_cast<float>(inside[index].distSq()));
+                        // Distances are between pixel centres, the edge lies halfway
+                        sum += (d > 0) ? d - 0.5f : d + 0.5f;
+                    }
+                }
+                float distance = sum / (sdfOversample * sdfOversample * sdfOversample);
+                long value = std::lround(128.0f + distance * 127.0f / sdfSpread);
+                sdfGlyph.distance[y * fieldWidth + x] = static_cast<unsigned char>(std::max(0L, std::min(255L, value)));
+            }
+        }
+        distanceBytes += sdfGlyph.distance.size();
+    }
+
+    closeFont(font);
+
+    if(Benchmark::isActive()) {
+        Benchmark::fontMemory(0, static_cast<long long>(distanceBytes));
+    }
+
+    std::stringstream ss;
+    ss << "Built distance field for " << fontPath_ << ": " << distanceBytes << " bytes";
+    LOG_INFO("Font", ss.str());
+
+    return !sdfGlyphs_.empty();
 }
 
+float Font::sampleSdf(const SdfGlyph &glyph, float x, float y)
+{
+    int width = glyph.width + 2 * sdfSpread;
+    int height = glyph.height + 2 * sdfSpread;
+
+    x = std::max(0.0f, std::min(static_cast<float>(width - 1), x));
+    y = std::max(0.0f, std::min(static_cast<float>(height - 1), y));
+    int x0 = static_cast<int>(x);
+    int y0 = static_cast<int>(y);
+    int x1 = std::min(x0 + 1, width - 1);
+    int y1 = std::min(y0 + 1, height - 1);
+    float fx = x - x0;
+    float fy = y - y0;
 
+    float top = glyph.distance[y0 * width + x0] * (1 - fx) + glyph.distance[y0 * width + x1] * fx;
+    float bottom = glyph.distance[y1 * width + x0] * (1 - fx) + glyph.distance[y1 * width + x1] * fx;
+    return top * (1 - fy) + bottom * fy;
+}
+
+bool Font::renderSdf(Font *sized)
+{
+    if(sdfGlyphs_.empty()) {
+        return false;
+    }
+
+    float scale = static_cast<float>(sized->fontSize_) / static_cast<float>(height);
+    sized->height = sized->fontSize_;
+    sized->ascent = static_cast<int>(std::lround(ascent * scale));
+
+    // Threshold the field on the CPU, this works on every SDL renderer
+    std::map<unsigned int, SdfGlyph>::iterator it;
+    for(it = sdfGlyphs_.begin(); it != sdfGlyphs_.end(); it++) {
+        const SdfGlyph &sdfGlyph = it->second;
+        GlyphInfoBuild *info = new GlyphInfoBuild;
+        memset(info, 0, sizeof(GlyphInfoBuild));
+
+        info->glyph.minX = static_cast<int>(std::lround(sdfGlyph.glyph.minX * scale));
+        info->glyph.maxX = static_cast<int>(std::lround(sdfGlyph.glyph.maxX * scale));
+        info->glyph.minY = static_cast<int>(std::lround(sdfGlyph.glyph.minY * scale));
+        info->glyph.maxY = static_cast<int>(std::lround(sdfGlyph.glyph.maxY * scale));
+        info->glyph.advance = static_cast<int>(std::lround(sdfGlyph.glyph.advance * scale));
+
+        int w = std::max(1, static_cast<int>(std::lround(sdfGlyph.width * scale)));
+        int h = std::max(1, static_cast<int>(std::lround(sdfGlyph.height * scale)));
+        info->surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+        if(!info->surface) {
+            delete info;
+            continue;
+        }
+        SDL_SetSurfaceBlendMode(info->surface, SDL_BLENDMODE_NONE);
+
+        SDL_LockSurface(info->surface);
+        for(int y = 0; y < h; ++y) {
+            Uint32 *row = reinterpret_cast<Uint32 *>(static_cast<Uint8 *>(info->surface->pixels) + y * info->surface->pitch);
+            float sy = (y + 0.5f) / scale - 0.5f + sdfSpread;
+            for(int x = 0; x < w; ++x) {
+                float sx = (x + 0.5f) / scale - 0.5f + sdfSpread;
+                float distance = (sampleSdf(sdfGlyph, sx, sy) - 128.0f) * sdfSpread / 127.0f * scale;
+                float coverage = std::max(0.0f, std::min(1.0f, distance + 0.5f));
+                row[x] = (static_cast<Uint32>(coverage * 255.0f + 0.5f) << 24) | 0x00ffffff;
+            }
+        }
+        SDL_UnlockSurface(info->surface);
+
+        sized->atlas[it->first] = info;
+    }
+
+    return sized->packAtlas() && sized->uploadAtlas();
+}
 
 void Font::deInitialize()
 {
+    // A colour variant only holds handles onto the shared atlas and its renditions,
+    // which stay valid. The atlas is torn down through FontCache::deInitializeFonts.
+    if(atlasFont_) {
+        return;
+    }
+
+    // Never free what a worker thread is still filling in
+    waitRasterized();
+
+    if(atlasSurface_) {
+        SDL_FreeSurface(atlasSurface_);
+        atlasSurface_ = NULL;
+    }
+
     if(texture) {
-        SDL_LockMutex(SDL::getMutex());
-        SDL_DestroyTexture(texture);
+        SDL::destroyTexture(texture);
         texture = NULL;
-        SDL_UnlockMutex(SDL::getMutex());
     }
+    if(textureBytes_ && Benchmark::isActive()) {
+        Benchmark::fontMemory(-static_cast<long long>(textureBytes_), 0);
+    }
+    textureBytes_ = 0;
 
     std::map<unsigned int, GlyphInfoBuild *>::iterator atlasIt = atlas.begin();
     while(atlasIt != atlas.end()) {
@@ -169,6 +787,19 @@ void Font::deInitialize()
         atlasIt = atlas.begin();
     }
 
+    if(sdf_) {
+        std::map<int, Font *>::iterator it;
+        for(it = sizedFonts_.begin(); it != sizedFonts_.end(); it++) {
+            it->second->deInitialize();
+        }
+        if(Benchmark::isActive()) {
+            long long fieldBytes = 0;
+            std::map<unsigned int, SdfGlyph>::iterator sdfIt;
+            for(sdfIt = sdfGlyphs_.begin(); sdfIt != sdfGlyphs_.end(); sdfIt++) {
+                fieldBytes += static_cast<long long>(sdfIt->second.distance.size());
+            }
+            Benchmark::fontMemory(0, -fieldBytes);
+        }
+        sdfGlyphs_.clear();
+    }
 }
-
-
@@ -16,8 +16,12 @@
 #pragma once
 
 #include <SDL2/SDL.h>
+#include "ThreadPool.h"
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <string>
+#include <vector>
 
 class Font
 {
@@ -32,14 +36,24 @@ public:
         SDL_Rect rect;
     };
 
-    Font(std::string fontPath, int fontSize, SDL_Color color, int monitor);
+    Font(std::string fontPath, int fontSize, SDL_Color color, int monitor, bool sdf = false);
+    Font(Font *atlasFont, SDL_Color color);
     virtual ~Font();
     bool initialize();
+    void initializeAsync();
     void deInitialize();
     SDL_Texture *getTexture();
+    SDL_Color getColor();
     bool getRect(unsigned int charCode, GlyphInfo &glyph);
     int getHeight();
     int getAscent();
+    bool isSdf();
+
+    // Returns the font to draw with at the given on-screen height in pixels.
+    // Signed distance field fonts hand out a rendition close to that height,
+    // or the nearest ready one while it renders on the pool. All other fonts
+    // return themselves. Callers scale by the returned font's height.
+    Font *getSizedFont(float fontHeight);
 
 private:
     struct GlyphInfoBuild
@@ -48,10 +62,45 @@ private:
         SDL_Surface *surface;
     };
 
+    struct SdfGlyph
+    {
+        Font::GlyphInfo glyph;
+        int width;
+        int height;
+        std::vector<unsigned char> distance;
+    };
+
+    Font(Font *sdfFont, int fontHeight);
+    bool rasterize();
+    void waitRasterized();
+    bool packAtlas();
+    bool uploadAtlas();
+    bool initializeSdf();
+    bool renderSdf(Font *sized);
+    float sampleSdf(const SdfGlyph &glyph, float x, float y);
+
+    // Colour variants borrow the white glyph atlas of another font and only
+    // apply their colour as texture colour modulation when drawn.
+    Font *atlasFont_;
+    // Renditions of a distance field font point back to the font holding the field
+    Font *sdfFont_;
+    bool sdf_;
     SDL_Texture *texture;
+    // Glyphs packed on a worker thread, turned into a texture on first draw
+    SDL_Surface *atlasSurface_;
+    std::atomic<bool> rasterizePending_;
+    // Set by the worker once it finished, so draws can check without waiting
+    std::atomic<bool> rasterizeDone_;
+    std::mutex rasterizeMutex_;
+    TaskGroup rasterized_;
     int height;
     int ascent;
+    size_t textureBytes_;
+    // SDL_GetTicks() of the last draw, renditions only
+    Uint32 lastUsed_;
     std::map<unsigned int, GlyphInfoBuild *> atlas;
+    std::map<unsigned int, SdfGlyph> sdfGlyphs_;
+    std::map<int, Font *> sizedFonts_;
     std::string fontPath_;
     int fontSize_;
     SDL_Color color_;
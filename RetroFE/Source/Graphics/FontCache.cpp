@@ -23,7 +23,8 @@
 #else
     #include <SDL2/SDL_ttf.h>
 #endif
-#include <sstream>
+#include <algorithm>
+#include <tuple>
 
 //todo: memory leak when launching games
 FontCache::FontCache()
@@ -37,15 +38,29 @@ FontCache::~FontCache()
 
 void FontCache::deInitialize()
 {
-    std::map<std::string, Font *>::iterator it = fontFaceMap_.begin();
+    // Colour variants reference the atlases, release them first
+    std::map<FontKey, Font *>::iterator it = fontFaceMap_.begin();
     while(it != fontFaceMap_.end()) {
         delete it->second;
         fontFaceMap_.erase(it);
         it = fontFaceMap_.begin();
     }
-    SDL_LockMutex(SDL::getMutex());
+    it = fontAtlasMap_.begin();
+    while(it != fontAtlasMap_.end()) {
+        delete it->second;
+        fontAtlasMap_.erase(it);
+        it = fontAtlasMap_.begin();
+    }
     TTF_Quit();
-    SDL_UnlockMutex(SDL::getMutex());
+}
+
+
+void FontCache::deInitializeFonts()
+{
+    std::map<FontKey, Font *>::iterator it;
+    for(it = fontAtlasMap_.begin(); it != fontAtlasMap_.end(); it++) {
+        it->second->deInitialize();
+    }
 }
 
 
@@ -54,11 +69,11 @@ void FontCache::initialize()
     //todo: make bool
     TTF_Init();
 }
-Font *FontCache::getFont(std::string fontPath, int fontSize, SDL_Color color)
+Font *FontCache::getFont(std::string fontPath, int fontSize, SDL_Color color, int monitor, bool sdf)
 {
     Font *t = NULL;
 
-    std::map<std::string, Font *>::iterator it = fontFaceMap_.find(buildFontKey(fontPath, fontSize, color));
+    std::map<FontKey, Font *>::iterator it = fontFaceMap_.find(buildFontKey(fontPath, fontSize, color, monitor, sdf));
 
     if(it != fontFaceMap_.end()) {
         t = it->second;
@@ -67,23 +82,47 @@ Font *FontCache::getFont(std::string fontPath, int fontSize, SDL_Color color)
     return t;
 }
 
-std::string FontCache::buildFontKey(std::string font, int fontSize, SDL_Color color)
+bool FontCache::FontKey::operator<(const FontKey &other) const
+{
+    return std::tie(fontSize, monitor, color, sdf, font) < std::tie(other.fontSize, other.monitor, other.color, other.sdf, other.font);
+}
+
+FontCache::FontKey FontCache::buildFontKey(const std::string &font, int fontSize, SDL_Color color, int monitor, bool sdf)
 {
-    std::stringstream ss;
-    ss << font << "_SIZE=" << fontSize << " RGB=" << color.r << "." << color.g << "." << color.b;
+    FontKey key;
+    key.font = font;
+    // A distance field covers every size, so loadFontSize does not matter
+    key.fontSize = sdf ? 0 : fontSize;
+    key.monitor = monitor;
+    key.color = (color.r << 16) | (color.g << 8) | color.b;
+    key.sdf = sdf;
 
-    return ss.str();
+    return key;
 }
 
-bool FontCache::loadFont(std::string fontPath, int fontSize, SDL_Color color, int monitor)
+bool FontCache::loadFont(std::string fontPath, int fontSize, SDL_Color color, int monitor, bool sdf)
 {
-    std::string key = buildFontKey(fontPath, fontSize, color);
-    std::map<std::string, Font *>::iterator it = fontFaceMap_.find(key);
+    FontKey key = buildFontKey(fontPath, fontSize, color, monitor, sdf);
+    std::map<FontKey, Font *>::iterator it = fontFaceMap_.find(key);
 
     if(it == fontFaceMap_.end()) {
-        Font *f = new Font(fontPath, fontSize, color, monitor);
-        f->initialize();
-        fontFaceMap_[key] = f;
+        SDL_Color white = {255, 255, 255, 255};
+        FontKey atlasKey = buildFontKey(fontPath, fontSize, white, monitor, sdf);
+        Font *atlas = NULL;
+
+        std::map<FontKey, Font *>::iterator atlasIt = fontAtlasMap_.find(atlasKey);
+        if(atlasIt == fontAtlasMap_.end()) {
+            atlas = new Font(fontPath, fontSize, white, monitor, sdf);
+            // Texture creation is deferred to the first draw on the render thread
+            // Glyphs are rasterized on the shared pool while the page is being built
+            atlas->initializeAsync();
+            fontAtlasMap_[atlasKey] = atlas;
+        }
+        else {
+            atlas = atlasIt->second;
+        }
+
+        fontFaceMap_[key] = new Font(atlas, color);
     }
 
     return true;
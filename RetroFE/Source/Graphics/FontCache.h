@@ -25,13 +25,28 @@ public:
     FontCache();
     void initialize();
     void deInitialize();
-    bool loadFont(std::string font, int fontSize, SDL_Color color, int monitor);
-    Font *getFont(std::string font, int fontSize, SDL_Color color);
+    // Frees the shared atlases' textures, e.g. before SDL is taken down. Fonts
+    // rebuild them on the next initialize().
+    void deInitializeFonts();
+    bool loadFont(std::string font, int fontSize, SDL_Color color, int monitor, bool sdf = false);
+    Font *getFont(std::string font, int fontSize, SDL_Color color, int monitor, bool sdf = false);
 
     virtual ~FontCache();
 private:
-    std::map<std::string, Font *> fontFaceMap_;
-    std::string buildFontKey(std::string font, int fontSize, SDL_Color color);
+    struct FontKey
+    {
+        std::string font;
+        int fontSize;
+        int monitor;
+        Uint32 color;
+        bool sdf;
+        bool operator<(const FontKey &other) const;
+    };
+
+    // One white atlas per face, size and renderer, shared by all colours
+    std::map<FontKey, Font *> fontAtlasMap_;
+    std::map<FontKey, Font *> fontFaceMap_;
+    FontKey buildFontKey(const std::string &font, int fontSize, SDL_Color color, int monitor, bool sdf);
 
 };
 
@@ -16,15 +16,18 @@
 
 #include "Page.h"
 #include "ComponentItemBinding.h"
+#include "Font.h"
 #include "Component/Component.h"
 #include "../Collection/CollectionInfo.h"
 #include "Component/Text.h"
+#include "Component/Image.h"
 #include "../Utility/Log.h"
 #include "Component/ScrollingList.h"
 #include "../Sound/Sound.h"
 #include "ComponentItemBindingBuilder.h"
 #include "PageBuilder.h"
 #include "../Utility/Utils.h"
+#include "../Utility/FrameProfiler.h"
 #include "../Database/GlobalOpts.h"
 #include <algorithm>
 #include <sstream>
@@ -40,6 +43,7 @@ Page::Page(Configuration &config, int layoutWidth, int layoutHeight)
     , playlistMenu_(NULL)
     , menuDepth_(0)
     , scrollActive_(false)
+    , lastScrollForward_(true)
     , selectedItem_(NULL)
     , textStatusComponent_(NULL)
     , loadSoundChunk_(NULL)
@@ -61,6 +65,9 @@ Page::Page(Configuration &config, int layoutWidth, int layoutHeight)
     }
 
     currentLayout_ = 0;
+
+    config_.getProperty(OPTION_CACHESTATICLAYERS, cacheStaticLayers_);
+    layerCache_.resize(SDL::getScreenCount());
 }
 
 
@@ -81,6 +88,7 @@ void Page::deInitialize()
     menus_.clear();
 
     // Deinitialize and clear LayerComponents
+    freeLayerCache();
     for (Component* component : LayerComponents) {
         component->freeGraphicsMemory();
         delete component;
@@ -352,12 +360,37 @@ bool Page::isGraphicsIdle()
 }
 
 
+// True when the next update can change the picture: a tween, video frame, scrolling text or menu scroll
+bool Page::isAnimating() const
+{
+    if (scrollActive_) {
+        return true;
+    }
+
+    for (auto const& menuList : menus_) {
+        for (ScrollingList const* menu : menuList) {
+            if (menu->isAnimating()) {
+                return true;
+            }
+        }
+    }
+
+    for (Component const* component : LayerComponents) {
+        if (component->isAnimating()) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
 void Page::start()
 {
     for(auto it = menus_.begin(); it != menus_.end(); ++it) {
         for(auto it2 = it->begin(); it2 != it->end(); ++it2) {
             ScrollingList *menu = *it2;
-            menu->triggerEvent( "enter" );
+            menu->triggerEvent( EVENT_ENTER );
             menu->triggerEnterEvent();
         }
     }
@@ -367,7 +400,7 @@ void Page::start()
     }
 
     for(auto it = LayerComponents.begin(); it != LayerComponents.end(); ++it) {
-        (*it)->triggerEvent( "enter" );
+        (*it)->triggerEvent( EVENT_ENTER );
     }
 }
 
@@ -377,7 +410,7 @@ void Page::stop()
     for(auto it = menus_.begin(); it != menus_.end(); ++it) {
         for(auto it2 = it->begin(); it2 != it->end(); ++it2) {
             ScrollingList *menu = *it2;
-            menu->triggerEvent( "exit" );
+            menu->triggerEvent( EVENT_EXIT );
             menu->triggerExitEvent();
         }
     }
@@ -387,7 +420,7 @@ void Page::stop()
     }
 
     for(auto it = LayerComponents.begin(); it != LayerComponents.end(); ++it) {
-        (*it)->triggerEvent( "exit" );
+        (*it)->triggerEvent( EVENT_EXIT );
     }
 }
 
@@ -481,14 +514,16 @@ void Page::setControlsType(const std::string& type)
 
 void Page::playlistChange()
 {
+    playlistId_ = Tween::playlistId(getPlaylistName());
+
     for(auto it = activeMenu_.begin(); it != activeMenu_.end(); it++) {
         ScrollingList *menu = *it;
         if(menu)
-            menu->setPlaylist(getPlaylistName());
+            menu->setPlaylist(playlistId_);
     }
 
     for(auto it = LayerComponents.begin(); it != LayerComponents.end(); ++it) {
-        (*it)->setPlaylist(getPlaylistName());
+        (*it)->setPlaylist(playlistId_);
     }
 
     updatePlaylistMenuPosition();
@@ -501,43 +536,43 @@ void Page::menuScroll()
         return;
 
     for (auto it = LayerComponents.begin(); it != LayerComponents.end(); ++it) {
-        (*it)->triggerEvent("menuScroll", menuDepth_ - 1);
+        (*it)->triggerEvent(EVENT_MENU_SCROLL, menuDepth_ - 1);
     }
 }
 
 void Page::highlightEnter()
 {
-    triggerEventOnAllMenus("highlightEnter");
+    triggerEventOnAllMenus(EVENT_HIGHLIGHT_ENTER);
 }
 
 void Page::highlightExit()
 {
-    triggerEventOnAllMenus("highlightExit");
+    triggerEventOnAllMenus(EVENT_HIGHLIGHT_EXIT);
 }
 
 void Page::playlistEnter()
 {
     // entered in new playlist set selected item
     setSelectedItem();
-    triggerEventOnAllMenus("playlistEnter");
+    triggerEventOnAllMenus(EVENT_PLAYLIST_ENTER);
 }
 
 void Page::playlistExit()
 {
-    triggerEventOnAllMenus("playlistExit");
+    triggerEventOnAllMenus(EVENT_PLAYLIST_EXIT);
 }
 
 void Page::playlistNextEnter()
 {
     fromPlaylistNav = true;
     fromPreviousPlaylist = false;
-    triggerEventOnAllMenus("playlistNextEnter");
+    triggerEventOnAllMenus(EVENT_PLAYLIST_NEXT_ENTER);
 }
 
 void Page::playlistNextExit()
 {
     fromPreviousPlaylist = false;
-    triggerEventOnAllMenus("playlistNextExit");
+    triggerEventOnAllMenus(EVENT_PLAYLIST_NEXT_EXIT);
     fromPlaylistNav = false;
 }
 
@@ -545,13 +580,13 @@ void Page::playlistPrevEnter()
 {
     fromPlaylistNav = true;
     fromPreviousPlaylist = true;
-    triggerEventOnAllMenus("playlistPrevEnter");
+    triggerEventOnAllMenus(EVENT_PLAYLIST_PREV_ENTER);
 }
 
 void Page::playlistPrevExit()
 {
     fromPreviousPlaylist = true;
-    triggerEventOnAllMenus("playlistPrevExit");
+    triggerEventOnAllMenus(EVENT_PLAYLIST_PREV_EXIT);
     fromPlaylistNav = false;
 }
 
@@ -559,63 +594,63 @@ void Page::menuJumpEnter()
 {
     // jumped into new item
     setSelectedItem();
-    triggerEventOnAllMenus("menuJumpEnter");
+    triggerEventOnAllMenus(EVENT_MENU_JUMP_ENTER);
 }
 
 void Page::menuJumpExit()
 {
-    triggerEventOnAllMenus("menuJumpExit");
+    triggerEventOnAllMenus(EVENT_MENU_JUMP_EXIT);
 }
 
 
 void Page::attractEnter()
 {
-    triggerEventOnAllMenus("attractEnter");
+    triggerEventOnAllMenus(EVENT_ATTRACT_ENTER);
 }
 
 void Page::attract()
 {
-    triggerEventOnAllMenus("attract");
+    triggerEventOnAllMenus(EVENT_ATTRACT);
 }
 
 void Page::attractExit()
 {
-    triggerEventOnAllMenus("attractExit");
+    triggerEventOnAllMenus(EVENT_ATTRACT_EXIT);
 }
 
 void Page::gameInfoEnter()
 {
-    triggerEventOnAllMenus("gameInfoEnter");
+    triggerEventOnAllMenus(EVENT_GAME_INFO_ENTER);
 }
 void Page::gameInfoExit()
 {
-    triggerEventOnAllMenus("gameInfoExit");
+    triggerEventOnAllMenus(EVENT_GAME_INFO_EXIT);
 }
 
 void Page::collectionInfoEnter()
 {
-    triggerEventOnAllMenus("collectionInfoEnter");
+    triggerEventOnAllMenus(EVENT_COLLECTION_INFO_ENTER);
 }
 void Page::collectionInfoExit()
 {
-    triggerEventOnAllMenus("collectionInfoExit");
+    triggerEventOnAllMenus(EVENT_COLLECTION_INFO_EXIT);
 }
 
 void Page::buildInfoEnter()
 {
-    triggerEventOnAllMenus("buildInfoEnter");
+    triggerEventOnAllMenus(EVENT_BUILD_INFO_ENTER);
 }
 void Page::buildInfoExit()
 {
-    triggerEventOnAllMenus("buildInfoExit");
+    triggerEventOnAllMenus(EVENT_BUILD_INFO_EXIT);
 }
 
 void Page::jukeboxJump()
 {
-    triggerEventOnAllMenus("jukeboxJump");
+    triggerEventOnAllMenus(EVENT_JUKEBOX_JUMP);
 }
 
-void Page::triggerEventOnAllMenus(const std::string& event)
+void Page::triggerEventOnAllMenus(AnimationEvent event)
 {
     if (!selectedItem_)
         return;
@@ -639,7 +674,7 @@ void Page::triggerEventOnAllMenus(const std::string& event)
 
 
 
-void Page::triggerEvent( const std::string& action )
+void Page::triggerEvent( AnimationEvent action )
 {
     for(auto it = LayerComponents.begin(); it != LayerComponents.end(); ++it) {
         (*it)->triggerEvent( action );
@@ -909,25 +944,25 @@ bool Page::popCollection()
 
 void Page::enterMenu()
 {
-    triggerEventOnAllMenus("menuEnter");
+    triggerEventOnAllMenus(EVENT_MENU_ENTER);
 }
 
 
 void Page::exitMenu()
 {
-    triggerEventOnAllMenus("menuExit");
+    triggerEventOnAllMenus(EVENT_MENU_EXIT);
 }
 
 
 void Page::enterGame()
 {
-    triggerEventOnAllMenus("gameEnter");
+    triggerEventOnAllMenus(EVENT_GAME_ENTER);
 }
 
 
 void Page::exitGame()
 {
-    triggerEventOnAllMenus("gameExit");
+    triggerEventOnAllMenus(EVENT_GAME_EXIT);
 }
 
 
@@ -937,6 +972,12 @@ std::string Page::getPlaylistName() const
 }
 
 
+int Page::getPlaylistId() const
+{
+    return playlistId_;
+}
+
+
 void Page::favPlaylist()
 {
     if(getPlaylistName() == "favorites") {
@@ -1132,63 +1173,66 @@ bool Page::playlistExists(const std::string& playlist)
 }
 
 
-void Page::update(float dt) {
-    std::string playlistName = getPlaylistName();
+void Page::update(double frameTime) {
+    // Components animate on per-frame deltas, which float holds comfortably
+    float dt = static_cast<float>(frameTime);
+    int playlistId = playlistId_;
 
     if (useThreading_) {
         // Asynchronous (threaded) version for non-OpenGL backends
 
-        // Future for asynchronous update of ScrollingLists within menus_
-        auto menuUpdateFuture = pool_.enqueue([this, dt, playlistName]() {
+        // ScrollingLists within menus_ update on a worker of the shared pool
+        TaskGroup updates;
+        updates.run([this, dt, playlistId]() {
             for (auto& menuList : menus_) {
                 for (auto* menu : menuList) {
-                    menu->playlistName = playlistName;
+                    menu->playlistId = playlistId;
                     menu->update(dt);
                 }
             }
             });
 
-        // Future for asynchronous update of LayerComponents
-        auto layerUpdateFuture = pool_.enqueue([this, dt, playlistName]() {
-            for (auto it = LayerComponents.begin(); it != LayerComponents.end();) {
-                if (*it) {
-                    (*it)->playlistName = playlistName;
-                    if ((*it)->update(dt) && (*it)->getAnimationDoneRemove()) {
-                        (*it)->freeGraphicsMemory();
-                        delete* it;
-                        it = LayerComponents.erase(it);
-                    }
-                    else {
-                        ++it;
-                    }
+        // LayerComponents update on this thread meanwhile
+        for (auto it = LayerComponents.begin(); it != LayerComponents.end();) {
+            if (*it) {
+                (*it)->playlistId = playlistId;
+                if ((*it)->update(dt) && (*it)->getAnimationDoneRemove()) {
+                    (*it)->freeGraphicsMemory();
+                    delete* it;
+                    it = LayerComponents.erase(it);
+                    layerCacheDirty_ = true;
                 }
                 else {
                     ++it;
                 }
             }
-            });
+            else {
+                ++it;
+            }
+        }
 
-        // Wait for asynchronous operations to complete
-        menuUpdateFuture.get();
-        layerUpdateFuture.get();
+        // Wait for the menus to complete
+        FrameProfiler::Scope wait(FrameProfiler::PhaseUpdateWait);
+        updates.wait();
     }
     else {
         // Synchronous (non-threaded) version for OpenGL backend
 
         for (auto& menuList : menus_) {
             for (auto* menu : menuList) {
-                menu->playlistName = playlistName;
+                menu->playlistId = playlistId;
                 menu->update(dt);
             }
         }
 
         for (auto it = LayerComponents.begin(); it != LayerComponents.end();) {
             if (*it) {
-                (*it)->playlistName = playlistName;
+                (*it)->playlistId = playlistId;
                 if ((*it)->update(dt) && (*it)->getAnimationDoneRemove()) {
                     (*it)->freeGraphicsMemory();
                     delete* it;
                     it = LayerComponents.erase(it);
+                    layerCacheDirty_ = true;
                 }
                 else {
                     ++it;
@@ -1244,11 +1288,23 @@ void Page::cleanup()
 
 void Page::draw()
 {
+    if (cacheStaticLayers_) {
+        for (int monitor = 0; monitor < static_cast<int>(layerCache_.size()); ++monitor) {
+            drawLayerCache(monitor);
+        }
+        layerCacheDirty_ = false;
+    }
+
     for(unsigned int i = 0; i < NUM_LAYERS; ++i) {
         // Drawing Components based on their layer
         for(auto it = LayerComponents.begin(); it != LayerComponents.end(); ++it) {
-            if(*it && (*it)->baseViewInfo.Layer == i)
+            if(*it && (*it)->baseViewInfo.Layer == i) {
+                int monitor = (*it)->baseViewInfo.Monitor;
+                if (cacheStaticLayers_ && monitor < static_cast<int>(layerCache_.size()) && layerCache_[monitor].valid &&
+                    layerCache_[monitor].memberSet.count(*it))
+                    continue;
                 (*it)->draw();
+            }
         }
 
         // Drawing Menus
@@ -1262,6 +1318,138 @@ void Page::draw()
 }
 
 
+// Compare the view properties that affect how an image is drawn
+static bool sameDrawState(ViewInfo const& a, ViewInfo const& b)
+{
+    return a.X == b.X && a.Y == b.Y && a.XOrigin == b.XOrigin && a.YOrigin == b.YOrigin &&
+        a.XOffset == b.XOffset && a.YOffset == b.YOffset && a.Width == b.Width && a.Height == b.Height &&
+        a.MinWidth == b.MinWidth && a.MaxWidth == b.MaxWidth && a.MinHeight == b.MinHeight && a.MaxHeight == b.MaxHeight &&
+        a.ImageWidth == b.ImageWidth && a.ImageHeight == b.ImageHeight && a.Angle == b.Angle && a.Alpha == b.Alpha &&
+        a.Layer == b.Layer && a.Monitor == b.Monitor && a.Additive == b.Additive &&
+        a.BackgroundRed == b.BackgroundRed && a.BackgroundGreen == b.BackgroundGreen &&
+        a.BackgroundBlue == b.BackgroundBlue && a.BackgroundAlpha == b.BackgroundAlpha &&
+        a.Reflection == b.Reflection && a.ReflectionDistance == b.ReflectionDistance &&
+        a.ReflectionScale == b.ReflectionScale && a.ReflectionAlpha == b.ReflectionAlpha &&
+        a.ContainerX == b.ContainerX && a.ContainerY == b.ContainerY &&
+        a.ContainerWidth == b.ContainerWidth && a.ContainerHeight == b.ContainerHeight;
+}
+
+
+// Draw the run of idle images at the bottom of a monitor's draw order from one cached texture.
+// The cache is rebuilt once the run has been unchanged for a frame, and dropped as soon as
+// a member animates, moves or the run changes.
+void Page::drawLayerCache(int monitor)
+{
+    LayerCache_S& cache = layerCache_[monitor];
+
+    unsigned int menuLayer = NUM_LAYERS;
+    for (auto const& menuList : menus_) {
+        for (ScrollingList const* menu : menuList) {
+            unsigned int lowest = menu->lowestLayer();
+            if (lowest < menuLayer)
+                menuLayer = lowest;
+        }
+    }
+    // Components sharing the lowest menu layer still draw before it
+    unsigned int runLimit = menuLayer < NUM_LAYERS ? menuLayer + 1 : NUM_LAYERS;
+
+    // A built cache stays while its members sit still and nothing new moved beneath them
+    if (cache.valid && !layerCacheDirty_ && runLimit >= cache.endLayer) {
+        for (size_t i = 0; cache.valid && i < cache.members.size(); ++i) {
+            Component const* member = cache.members[i];
+            cache.valid = !member->isAnimating() && sameDrawState(member->baseViewInfo, cache.states[i]);
+        }
+        for (Component* component : LayerComponents) {
+            if (cache.valid && component && component->baseViewInfo.Monitor == monitor &&
+                component->baseViewInfo.Layer < cache.endLayer && !cache.memberSet.count(component))
+                cache.valid = false;
+        }
+    }
+    else {
+        cache.valid = false;
+    }
+
+    int width  = getLayoutWidthByMonitor(monitor);
+    int height = getLayoutHeightByMonitor(monitor);
+
+    if (!cache.valid) {
+        cache.memberSet.clear();
+
+        std::vector<Component *> run;
+        unsigned int endLayer = runLimit;
+        for (unsigned int i = 0; i < endLayer; ++i) {
+            for (Component* component : LayerComponents) {
+                if (!component || component->baseViewInfo.Layer != i || component->baseViewInfo.Monitor != monitor)
+                    continue;
+                if (!dynamic_cast<Image *>(component) || component->isAnimating()) {
+                    endLayer = i;
+                    break;
+                }
+                run.push_back(component);
+            }
+        }
+
+        // Only flatten runs that are worth it and have settled for a frame
+        if (run.size() < 2 || layerCacheDirty_ || run != cache.pending) {
+            cache.pending = run;
+            return;
+        }
+
+        int textureWidth  = 0;
+        int textureHeight = 0;
+        if (cache.texture)
+            SDL_QueryTexture(cache.texture, nullptr, nullptr, &textureWidth, &textureHeight);
+        if (textureWidth != width || textureHeight != height) {
+            if (cache.texture)
+                SDL_DestroyTexture(cache.texture);
+            cache.texture = SDL_CreateTexture(SDL::getRenderer(monitor), SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, width, height);
+            if (cache.texture)
+                SDL_SetTextureBlendMode(cache.texture, SDL_BLENDMODE_NONE);
+        }
+        if (!cache.texture || !SDL::beginCapture(monitor, cache.texture)) {
+            LOG_WARNING("Page", "Render targets unavailable; static layer caching disabled");
+            freeLayerCache();
+            cacheStaticLayers_ = false;
+            return;
+        }
+        for (Component* component : run) {
+            component->draw();
+        }
+        SDL::endCapture(monitor);
+
+        cache.members = run;
+        cache.memberSet.clear();
+        cache.memberSet.insert(run.begin(), run.end());
+        cache.states.clear();
+        for (Component const* component : run) {
+            cache.states.push_back(component->baseViewInfo);
+        }
+        cache.endLayer = endLayer;
+        cache.valid = true;
+    }
+
+    SDL_Rect rect = { 0, 0, width, height };
+    cache.viewInfo.Monitor = monitor;
+    SDL::renderCopy(cache.texture, 1.0f, nullptr, &rect, cache.viewInfo, width, height);
+}
+
+
+void Page::freeLayerCache()
+{
+    for (LayerCache_S& cache : layerCache_) {
+        if (cache.texture) {
+            SDL::destroyTexture(cache.texture);
+            cache.texture = nullptr;
+        }
+        cache.members.clear();
+        cache.memberSet.clear();
+        cache.states.clear();
+        cache.pending.clear();
+        cache.valid = false;
+    }
+}
+
+
 void Page::removePlaylist()
 {
     if (!selectedItem_)
@@ -1368,6 +1556,8 @@ void Page::freeGraphicsMemory()
     for (Component* component : LayerComponents) {
         component->freeGraphicsMemory();
     }
+
+    freeLayerCache();
 }
 
 
@@ -1392,11 +1582,23 @@ void Page::allocateGraphicsMemory()
     if (highlightSoundChunk_) highlightSoundChunk_->allocate();
     if (selectSoundChunk_) selectSoundChunk_->allocate();
 
+    // Decode the layer images on the pool; the loop below then only uploads them
+    std::vector<Image*> images;
+    for (auto const& component : LayerComponents) {
+        if (auto* image = dynamic_cast<Image*>(component)) {
+            images.push_back(image);
+        }
+    }
+    ThreadPool::instance().parallelFor(0, images.size(), [&images](size_t i) {
+        images[i]->decode();
+    });
+
     for (auto& component : LayerComponents) {
         if (component) {
             component->allocateGraphicsMemory();
         }
     }
+    layerCacheDirty_ = true;
     LOG_DEBUG("Page", "Allocate graphics memory complete");
 }
 
@@ -1412,6 +1614,10 @@ void Page::deInitializeFonts() const
     for (Component* component : LayerComponents) {
         component->deInitializeFonts();
     }
+
+    if (overlayFont_) {
+        overlayFont_->deInitialize();
+    }
 }
 
 void Page::initializeFonts() const
@@ -1425,6 +1631,20 @@ void Page::initializeFonts() const
     for (Component* component : LayerComponents) {
         component->initializeFonts();
     }
+
+    if (overlayFont_) {
+        overlayFont_->initialize();
+    }
+}
+
+void Page::setOverlayFont(Font *font)
+{
+    overlayFont_ = font;
+}
+
+Font *Page::getOverlayFont() const
+{
+    return overlayFont_;
 }
 
 
@@ -1462,6 +1682,12 @@ bool Page::isMenuScrolling() const
 }
 
 
+bool Page::isLastScrollForward() const
+{
+    return lastScrollForward_;
+}
+
+
 bool Page::isPlaying() const
 {
     for(auto& component : LayerComponents) {
@@ -1504,9 +1730,11 @@ bool Page::isMenuFastScrolling() const
 
 
 void Page::scroll(bool forward) {
+    lastScrollForward_ = forward;
     if (useThreading_) {
         // Asynchronous version
-        auto scrollFuture = pool_.enqueue([this, forward]() {
+        TaskGroup scrollTask;
+        scrollTask.run([this, forward]() {
             for (auto& menu : activeMenu_) {
                 if (menu && !menu->isPlaylist()) {
                     menu->scroll(forward);
@@ -1516,7 +1744,7 @@ void Page::scroll(bool forward) {
             });
 
         // Wait for the scroll operation to complete
-        scrollFuture.get();
+        scrollTask.wait();
 
         if (highlightSoundChunk_) {
             highlightSoundChunk_->play();
@@ -1573,6 +1801,17 @@ int Page::getLayoutHeightByMonitor(int monitor)
 }
 
 
+float Page::getScreenScaleByMonitor(int monitor)
+{
+    int layoutWidth = getLayoutWidthByMonitor(monitor);
+    int layoutHeight = getLayoutHeightByMonitor(monitor);
+    if (layoutWidth <= 0 || layoutHeight <= 0)
+        return 1.0f;
+    return std::max(static_cast<float>(SDL::getWindowWidth(monitor)) / static_cast<float>(layoutWidth),
+                    static_cast<float>(SDL::getWindowHeight(monitor)) / static_cast<float>(layoutHeight));
+}
+
+
 void Page::setLayoutWidthByMonitor(int monitor, int width)
 {
     if (monitor < SDL::getScreenCount())
@@ -17,13 +17,17 @@
 
 #include "../Collection/CollectionInfo.h"
 #include "ThreadPool.h"
+#include "ViewInfo.h"
 
 #include <map>
 #include <string>
 #include <list>
+#include <unordered_set>
 #include <vector>
 
+struct SDL_Texture;
 class Component;
+class Font;
 class Configuration;
 class ScrollingList;
 class Text;
@@ -35,8 +39,7 @@ class Page
 
 public:
 
-    ThreadPool pool_{ 4 };
-    ;    enum ScrollDirection
+    enum ScrollDirection
     {
         ScrollDirectionForward,
         ScrollDirectionBack,
@@ -60,6 +63,7 @@ public:
     void enterGame();
     void exitGame();
     std::string getPlaylistName() const;
+    int getPlaylistId() const;
     void favPlaylist();
     void nextPlaylist();
     void prevPlaylist();
@@ -90,6 +94,8 @@ public:
     int getCurrentLayout() const;
     int getLayoutWidthByMonitor(int monitor);
     int getLayoutHeightByMonitor(int monitor);
+    // Screen pixels per layout unit on a monitor, 1 when its layout size is unknown
+    float getScreenScaleByMonitor(int monitor);
     void setLayoutWidthByMonitor(int monitor, int width);
     void setLayoutHeightByMonitor(int monitor, int height);
     void setScrolling(ScrollDirection direction);
@@ -103,9 +109,10 @@ public:
     bool isIdle();
     bool isAttractIdle();
     bool isGraphicsIdle();
+    bool isAnimating() const;
     bool isMenuIdle();
     void setStatusTextComponent(Text *t);
-    void update(float dt);
+    void update(double frameTime);
     void updateReloadables(float dt);
     void cleanup();
     void draw();
@@ -113,6 +120,9 @@ public:
     void allocateGraphicsMemory();
     void deInitializeFonts( ) const;
     void initializeFonts( ) const;
+    // Layout font in white, for diagnostics drawn on top of the page
+    void setOverlayFont(Font *font);
+    Font *getOverlayFont() const;
     void playSelect();
     bool isSelectPlaying();
     std::string getCollectionName();
@@ -130,7 +140,7 @@ public:
     void playlistNextExit();
     void playlistPrevEnter();
     void playlistPrevExit();
-    void triggerEventOnAllMenus(const std::string& event);
+    void triggerEventOnAllMenus(AnimationEvent event);
     void  menuJumpEnter();
     void  menuJumpExit();
     void  attractEnter( );
@@ -143,7 +153,7 @@ public:
     void buildInfoEnter();
     void buildInfoExit();
     void  jukeboxJump( );
-    void  triggerEvent( const std::string& action );
+    void  triggerEvent( AnimationEvent action );
     void  setText( const std::string& text, int id );
     void  addPlaylist();
     void  removePlaylist();
@@ -155,6 +165,8 @@ public:
     void  updateScrollPeriod() const;
     bool  isMenuFastScrolling() const;
     void  scroll(bool forward);
+    // Direction of the last single-item scroll, where the next selection most likely is
+    bool  isLastScrollForward() const;
     bool  hasSubs();
     int   getLayoutWidth(int layout);
     int   getLayoutHeight(int layout);
@@ -184,6 +196,8 @@ public:
 
 private:
     void playlistChange();
+    void drawLayerCache(int monitor);
+    void freeLayerCache();
     std::string collectionName_;
     Configuration &config_;
     std::string controlsType_;
@@ -216,6 +230,7 @@ private:
     std::map<std::string, size_t> lastPlaylistOffsets_;
 
     bool scrollActive_;
+    bool lastScrollForward_;
 
     Item *selectedItem_;
     Text *textStatusComponent_;
@@ -225,6 +240,7 @@ private:
     Sound *selectSoundChunk_;
     float minShowTime_;
     CollectionInfo::Playlists_T::iterator playlist_;
+    int playlistId_{ -1 }; // Tween::playlistId() of playlist_, refreshed by playlistChange()
     std::vector<int> layoutWidth_;
     std::vector<int> layoutHeight_;
     std::vector<int> layoutWidthByMonitor_;
@@ -232,4 +248,23 @@ private:
     bool jukebox_;
     bool useThreading_;
 
+    // Static images at the bottom of a monitor's draw order, flattened into one texture
+    struct LayerCache_S
+    {
+        SDL_Texture *texture{ nullptr };
+        std::vector<Component *> members;
+        // The same members for lookups while drawing, filled when the cache is built
+        std::unordered_set<Component *> memberSet;
+        std::vector<ViewInfo> states;
+        std::vector<Component *> pending;
+        ViewInfo viewInfo;
+        // Layer the run stopped at, whatever sits below it must be a member
+        unsigned int endLayer{ 0 };
+        bool valid{ false };
+    };
+    std::vector<LayerCache_S> layerCache_;
+    bool cacheStaticLayers_{ false };
+    bool layerCacheDirty_{ false };
+    Font *overlayFont_{ nullptr };
+
 };
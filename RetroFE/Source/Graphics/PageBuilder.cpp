@@ -197,6 +197,7 @@ Page *PageBuilder::buildPage( const std::string& collectionName, bool defaultToC
                 xml_attribute<> const* fontXml = root->first_attribute("font");
                 xml_attribute<> const* fontColorXml = root->first_attribute("fontColor");
                 xml_attribute<> const* fontSizeXml = root->first_attribute("loadFontSize");
+                xml_attribute<> const* fontSdfXml = root->first_attribute("fontSdf");
                 xml_attribute<> const* minShowTimeXml = root->first_attribute("minShowTime");
                 xml_attribute<> const* controls = root->first_attribute("controls");
                 xml_attribute<> const* layoutMonitorXml = root->first_attribute("monitor");
@@ -224,6 +225,10 @@ Page *PageBuilder::buildPage( const std::string& collectionName, bool defaultToC
                     fontSize_ = Utils::convertInt(fontSizeXml->value());
                 }
 
+                if (fontSdfXml) {
+                    fontSdf_ = Utils::toLower(fontSdfXml->value()) == "true" || Utils::toLower(fontSdfXml->value()) == "yes";
+                }
+
                 if (layoutWidthXml && layoutHeightXml) {
                     layoutWidth_ = Utils::convertInt(layoutWidthXml->value());
                     layoutHeight_ = Utils::convertInt(layoutHeightXml->value());
@@ -252,6 +257,12 @@ Page *PageBuilder::buildPage( const std::string& collectionName, bool defaultToC
                     page->setMinShowTime(Utils::convertFloat(minShowTimeXml->value()));
                 }
 
+                if (page && !page->getOverlayFont() && !fontName_.empty()) {
+                    SDL_Color white = { 255, 255, 255, 255 };
+                    fontCache_->loadFont(fontName_, fontSize_, white, 0, fontSdf_);
+                    page->setOverlayFont(fontCache_->getFont(fontName_, fontSize_, white, 0, fontSdf_));
+                }
+
                 // add additional controls to replace others based on theme/layout
 				if (controls && controls->value() && controls->value()[0] != '\0'){
                     std::string controlLayout = controls->value();
@@ -892,6 +903,7 @@ Font *PageBuilder::addFont(const xml_node<> *component, const xml_node<> *defaul
     xml_attribute<> const *fontXml = component->first_attribute("font");
     xml_attribute<> const *fontColorXml = component->first_attribute("fontColor");
     xml_attribute<> const *fontSizeXml = component->first_attribute("loadFontSize");
+    xml_attribute<> const *fontSdfXml = component->first_attribute("fontSdf");
 
     if(defaults) {
         if(!fontXml && defaults->first_attribute("font")) {
@@ -905,6 +917,10 @@ Font *PageBuilder::addFont(const xml_node<> *component, const xml_node<> *defaul
         if(!fontSizeXml && defaults->first_attribute("loadFontSize")) {
             fontSizeXml = defaults->first_attribute("loadFontSize");
         }
+
+        if(!fontSdfXml && defaults->first_attribute("fontSdf")) {
+            fontSdfXml = defaults->first_attribute("fontSdf");
+        }
     }
 
 
@@ -912,6 +928,7 @@ Font *PageBuilder::addFont(const xml_node<> *component, const xml_node<> *defaul
     std::string fontName = fontName_;
     SDL_Color fontColor = fontColor_;
     int fontSize = fontSize_;
+    bool fontSdf = fontSdf_;
 
     if(fontXml) {
         fontName = Configuration::convertToAbsolutePath(
@@ -937,8 +954,12 @@ Font *PageBuilder::addFont(const xml_node<> *component, const xml_node<> *defaul
         fontSize = Utils::convertInt(fontSizeXml->value());
     }
 
-    fontCache_->loadFont(fontName, fontSize, fontColor, monitor);
-    return fontCache_->getFont(fontName, fontSize, fontColor);
+    if(fontSdfXml) {
+        fontSdf = Utils::toLower(fontSdfXml->value()) == "true" || Utils::toLower(fontSdfXml->value()) == "yes";
+    }
+
+    fontCache_->loadFont(fontName, fontSize, fontColor, monitor, fontSdf);
+    return fontCache_->getFont(fontName, fontSize, fontColor, monitor, fontSdf);
 }
 
 void PageBuilder::loadTweens(Component *c, xml_node<> *componentXml)
@@ -952,47 +973,47 @@ AnimationEvents *PageBuilder::createTweenInstance(rapidxml::xml_node<> *componen
 {
     auto *tweens = new AnimationEvents();
 
-    buildTweenSet(tweens, componentXml, "onEnter",          "enter");
-    buildTweenSet(tweens, componentXml, "onExit",           "exit");
-    buildTweenSet(tweens, componentXml, "onIdle",           "idle");
-    buildTweenSet(tweens, componentXml, "onMenuIdle",       "menuIdle");
-    buildTweenSet(tweens, componentXml, "onMenuScroll",     "menuScroll");
-    buildTweenSet(tweens, componentXml, "onHighlightEnter", "highlightEnter");
-    buildTweenSet(tweens, componentXml, "onHighlightExit",  "highlightExit");
-    buildTweenSet(tweens, componentXml, "onMenuEnter",      "menuEnter");
-    buildTweenSet(tweens, componentXml, "onMenuExit",       "menuExit");
-    buildTweenSet(tweens, componentXml, "onGameEnter",      "gameEnter");
-    buildTweenSet(tweens, componentXml, "onGameExit",       "gameExit");
-    buildTweenSet(tweens, componentXml, "onPlaylistEnter",  "playlistEnter");
-    buildTweenSet(tweens, componentXml, "onPlaylistExit",   "playlistExit");
-    buildTweenSet(tweens, componentXml, "onPlaylistNextEnter", "playlistNextEnter");
-    buildTweenSet(tweens, componentXml, "onPlaylistNextExit", "playlistNextExit");
-    buildTweenSet(tweens, componentXml, "onPlaylistPrevEnter", "playlistPrevEnter");
-    buildTweenSet(tweens, componentXml, "onPlaylistPrevExit", "playlistPrevExit");
-    buildTweenSet(tweens, componentXml, "onMenuJumpEnter",  "menuJumpEnter");
-    buildTweenSet(tweens, componentXml, "onMenuJumpExit",   "menuJumpExit");
-    buildTweenSet(tweens, componentXml, "onAttractEnter",   "attractEnter");
-    buildTweenSet(tweens, componentXml, "onAttract",        "attract");
-    buildTweenSet(tweens, componentXml, "onAttractExit",    "attractExit");
-    buildTweenSet(tweens, componentXml, "onJukeboxJump",    "jukeboxJump");
-
-
-    buildTweenSet(tweens, componentXml, "onGameInfoEnter", "gameInfoEnter");
-    buildTweenSet(tweens, componentXml, "onGameInfoExit", "gameInfoExit");
-    buildTweenSet(tweens, componentXml, "onCollectionInfoEnter", "collectionInfoEnter");
-    buildTweenSet(tweens, componentXml, "onCollectionInfoExit", "collectionInfoExit");
-    buildTweenSet(tweens, componentXml, "onBuildInfoEnter", "buildInfoEnter");
-    buildTweenSet(tweens, componentXml, "onBuildInfoExit", "buildInfoExit");
-
-    buildTweenSet(tweens, componentXml, "onMenuActionInputEnter",  "menuActionInputEnter");
-    buildTweenSet(tweens, componentXml, "onMenuActionInputExit",   "menuActionInputExit");
-    buildTweenSet(tweens, componentXml, "onMenuActionSelectEnter", "menuActionSelectEnter");
-    buildTweenSet(tweens, componentXml, "onMenuActionSelectExit",  "menuActionSelectExit");
+    buildTweenSet(tweens, componentXml, "onEnter",          EVENT_ENTER);
+    buildTweenSet(tweens, componentXml, "onExit",           EVENT_EXIT);
+    buildTweenSet(tweens, componentXml, "onIdle",           EVENT_IDLE);
+    buildTweenSet(tweens, componentXml, "onMenuIdle",       EVENT_MENU_IDLE);
+    buildTweenSet(tweens, componentXml, "onMenuScroll",     EVENT_MENU_SCROLL);
+    buildTweenSet(tweens, componentXml, "onHighlightEnter", EVENT_HIGHLIGHT_ENTER);
+    buildTweenSet(tweens, componentXml, "onHighlightExit",  EVENT_HIGHLIGHT_EXIT);
+    buildTweenSet(tweens, componentXml, "onMenuEnter",      EVENT_MENU_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuExit",       EVENT_MENU_EXIT);
+    buildTweenSet(tweens, componentXml, "onGameEnter",      EVENT_GAME_ENTER);
+    buildTweenSet(tweens, componentXml, "onGameExit",       EVENT_GAME_EXIT);
+    buildTweenSet(tweens, componentXml, "onPlaylistEnter",  EVENT_PLAYLIST_ENTER);
+    buildTweenSet(tweens, componentXml, "onPlaylistExit",   EVENT_PLAYLIST_EXIT);
+    buildTweenSet(tweens, componentXml, "onPlaylistNextEnter", EVENT_PLAYLIST_NEXT_ENTER);
+    buildTweenSet(tweens, componentXml, "onPlaylistNextExit", EVENT_PLAYLIST_NEXT_EXIT);
+    buildTweenSet(tweens, componentXml, "onPlaylistPrevEnter", EVENT_PLAYLIST_PREV_ENTER);
+    buildTweenSet(tweens, componentXml, "onPlaylistPrevExit", EVENT_PLAYLIST_PREV_EXIT);
+    buildTweenSet(tweens, componentXml, "onMenuJumpEnter",  EVENT_MENU_JUMP_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuJumpExit",   EVENT_MENU_JUMP_EXIT);
+    buildTweenSet(tweens, componentXml, "onAttractEnter",   EVENT_ATTRACT_ENTER);
+    buildTweenSet(tweens, componentXml, "onAttract",        EVENT_ATTRACT);
+    buildTweenSet(tweens, componentXml, "onAttractExit",    EVENT_ATTRACT_EXIT);
+    buildTweenSet(tweens, componentXml, "onJukeboxJump",    EVENT_JUKEBOX_JUMP);
+
+
+    buildTweenSet(tweens, componentXml, "onGameInfoEnter", EVENT_GAME_INFO_ENTER);
+    buildTweenSet(tweens, componentXml, "onGameInfoExit", EVENT_GAME_INFO_EXIT);
+    buildTweenSet(tweens, componentXml, "onCollectionInfoEnter", EVENT_COLLECTION_INFO_ENTER);
+    buildTweenSet(tweens, componentXml, "onCollectionInfoExit", EVENT_COLLECTION_INFO_EXIT);
+    buildTweenSet(tweens, componentXml, "onBuildInfoEnter", EVENT_BUILD_INFO_ENTER);
+    buildTweenSet(tweens, componentXml, "onBuildInfoExit", EVENT_BUILD_INFO_EXIT);
+
+    buildTweenSet(tweens, componentXml, "onMenuActionInputEnter",  EVENT_MENU_ACTION_INPUT_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuActionInputExit",   EVENT_MENU_ACTION_INPUT_EXIT);
+    buildTweenSet(tweens, componentXml, "onMenuActionSelectEnter", EVENT_MENU_ACTION_SELECT_ENTER);
+    buildTweenSet(tweens, componentXml, "onMenuActionSelectExit",  EVENT_MENU_ACTION_SELECT_EXIT);
 
     return tweens;
 }
 
-void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXml, const std::string& tagName, const std::string& tweenName)
+void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXml, const std::string& tagName, AnimationEvent event)
 {
     for(componentXml = componentXml->first_node(tagName.c_str()); componentXml; componentXml = componentXml->next_sibling(tagName.c_str())) {
         xml_attribute<> const *indexXml = componentXml->first_attribute("menuIndex");
@@ -1006,7 +1027,7 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
                     if(i != index) {
                         auto *animation = new Animation();
                         getTweenSet(componentXml, animation);
-                        tweens->setAnimation(tweenName, i, animation);
+                        tweens->setAnimation(event, i, animation);
                     }
                 }
             }
@@ -1017,7 +1038,7 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
                     if(i < index) {
                         auto *animation = new Animation();
                         getTweenSet(componentXml, animation);
-                        tweens->setAnimation(tweenName, i, animation);
+                        tweens->setAnimation(event, i, animation);
                     }
                 }
             }
@@ -1028,26 +1049,26 @@ void PageBuilder::buildTweenSet(AnimationEvents *tweens, xml_node<> *componentXm
                     if(i > index) {
                         auto *animation = new Animation();
                         getTweenSet(componentXml, animation);
-                        tweens->setAnimation(tweenName, i, animation);
+                        tweens->setAnimation(event, i, animation);
                     }
                 }
             }
             else if(indexs[0] == 'i') {
                 auto *animation = new Animation();
                 getTweenSet(componentXml, animation);
-                tweens->setAnimation(tweenName, MENU_INDEX_HIGH, animation);
+                tweens->setAnimation(event, MENU_INDEX_HIGH, animation);
             }
             else {
                 int index = Utils::convertInt(indexXml->value());
                 auto *animation = new Animation();
                 getTweenSet(componentXml, animation);
-                tweens->setAnimation(tweenName, index, animation);
+                tweens->setAnimation(event, index, animation);
             }
         }
         else {
             auto *animation = new Animation();
             getTweenSet(componentXml, animation);
-            tweens->setAnimation(tweenName, -1, animation);
+            tweens->setAnimation(event, -1, animation);
         }
     }
 }
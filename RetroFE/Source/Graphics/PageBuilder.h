@@ -54,6 +54,7 @@ private:
     SDL_Color fontColor_;
     std::string fontName_;
     int fontSize_{ 24 };
+    bool fontSdf_{ false };
     FontCache *fontCache_;
     bool isMenu_;
 
@@ -65,7 +66,7 @@ private:
     bool buildComponents(rapidxml::xml_node<> *layout, Page *page, const std::string&);
     void loadTweens(Component *c, rapidxml::xml_node<> *componentXml);
     AnimationEvents *createTweenInstance(rapidxml::xml_node<> *componentXml);
-    void buildTweenSet(AnimationEvents *tweens, rapidxml::xml_node<> *componentXml, const std::string& tagName, const std::string& tweenName);
+    void buildTweenSet(AnimationEvents *tweens, rapidxml::xml_node<> *componentXml, const std::string& tagName, AnimationEvent event);
     ScrollingList * buildMenu(rapidxml::xml_node<> *menuXml, Page &p, int monitor);
     void buildCustomMenu(ScrollingList *menu, const rapidxml::xml_node<> *menuXml, rapidxml::xml_node<> *itemDefaults);
     void buildVerticalMenu(ScrollingList *menu, const rapidxml::xml_node<> *menuXml, rapidxml::xml_node<> *itemDefaults);
@@ -1,36 +1,226 @@
 #include "ThreadPool.h"
+#include <algorithm>
+#include <stdexcept>
 
-// Constructor
-ThreadPool::ThreadPool(size_t threads) : stop(false) {
-    for (size_t i = 0; i < threads; ++i)
-        workers.emplace_back(
-            [this] {
-                for (;;) {
-                    std::function<void()> task; {
-                        std::unique_lock<std::mutex> lock(this->queueMutex);
-                        this->condition.wait(lock,
-                            [this] { return this->stop || !this->tasks.empty(); });
+// Where the calling thread sits, so tasks queued by a worker stay on its own queue
+static thread_local ThreadPool *currentPool = nullptr;
+static thread_local size_t currentQueue = 0;
+
+static const size_t initialQueueSize = 64;
+
+Task::Task(Task&& other) noexcept : ops_(other.ops_), group_(other.group_) {
+    if (ops_) {
+        ops_->move(other.storage_, storage_);
+        other.ops_ = nullptr;
+    }
+}
+
+Task& Task::operator=(Task&& other) noexcept {
+    if (this != &other) {
+        reset();
+        ops_   = other.ops_;
+        group_ = other.group_;
+        if (ops_) {
+            ops_->move(other.storage_, storage_);
+            other.ops_ = nullptr;
+        }
+    }
+    return *this;
+}
+
+Task::~Task() {
+    reset();
+}
+
+void Task::reset() {
+    if (ops_) {
+        ops_->destroy(storage_);
+        ops_ = nullptr;
+    }
+}
+
+void ThreadPool::WorkQueue::push(Task&& task) {
+    if (count == ring.size()) {
+        // Full: unwrap into a ring twice the size
+        std::vector<Task> grown(std::max(initialQueueSize, ring.size() * 2));
+        for (size_t i = 0; i < count; ++i)
+            grown[i] = std::move(ring[(head + i) % ring.size()]);
+        ring.swap(grown);
+        head = 0;
+    }
+    ring[(head + count) % ring.size()] = std::move(task);
+    ++count;
+}
+
+bool ThreadPool::WorkQueue::popBack(Task& task) {
+    if (count == 0)
+        return false;
+    --count;
+    task = std::move(ring[(head + count) % ring.size()]);
+    return true;
+}
 
-                        if (this->stop && this->tasks.empty())
-                            return;
+bool ThreadPool::WorkQueue::popFront(Task& task) {
+    if (count == 0)
+        return false;
+    task = std::move(ring[head]);
+    head = (head + 1) % ring.size();
+    --count;
+    return true;
+}
 
-                        task = std::move(this->tasks.front());
-                        this->tasks.pop();
-                    }
+bool ThreadPool::WorkQueue::popGroup(TaskGroup *group, Task& task) {
+    for (size_t i = 0; i < count; ++i) {
+        size_t slot = (head + i) % ring.size();
+        if (ring[slot].group() != group)
+            continue;
 
-                    task();
-                }
-            }
-    );
+        task = std::move(ring[slot]);
+        // Close the gap, keeping the order of the remaining tasks
+        for (size_t j = i + 1; j < count; ++j)
+            ring[(head + j - 1) % ring.size()] = std::move(ring[(head + j) % ring.size()]);
+        --count;
+        return true;
+    }
+    return false;
 }
 
-// Destructor joins all threads
+// Constructor
+ThreadPool::ThreadPool(size_t threads)
+    : nextQueue_(0)
+    , queued_(0)
+    , sleeping_(0)
+    , stop_(false) {
+    threads = std::max<size_t>(1, threads);
+    for (size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<WorkQueue>());
+        queues_.back()->ring.resize(initialQueueSize);
+    }
+    for (size_t i = 0; i < threads; ++i)
+        workers_.emplace_back([this, i] { workerLoop(i); });
+}
+
+// Destructor runs what is still queued, then joins all threads
 ThreadPool::~ThreadPool() {
     {
-        std::unique_lock<std::mutex> lock(queueMutex);
-        stop = true;
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        stop_ = true;
     }
-    condition.notify_all();
-    for (std::thread& worker : workers)
+    wake_.notify_all();
+    for (std::thread& worker : workers_)
         worker.join();
 }
+
+ThreadPool &ThreadPool::instance() {
+    static ThreadPool pool(std::max(2u, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void ThreadPool::schedule(Task&& task) {
+    size_t index = (currentPool == this) ? currentQueue
+                 : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        if (stop_)
+            throw std::runtime_error("enqueue on stopped ThreadPool");
+        queues_[index]->push(std::move(task));
+    }
+
+    // Pairs with the check in workerLoop: either the worker sees the task or we see it asleep
+    queued_.fetch_add(1);
+    if (sleeping_.load() > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        wake_.notify_one();
+    }
+}
+
+bool ThreadPool::findTask(size_t index, Task& task) {
+    {
+        std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+        if (queues_[index]->popBack(task)) {
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+    for (size_t i = 1; i < queues_.size(); ++i) {
+        WorkQueue& victim = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (victim.popFront(task)) {
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ThreadPool::findGroupTask(TaskGroup *group, Task& task) {
+    size_t start = (currentPool == this) ? currentQueue : 0;
+    for (size_t i = 0; i < queues_.size(); ++i) {
+        WorkQueue& queue = *queues_[(start + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (queue.popGroup(group, task)) {
+            queued_.fetch_sub(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::workerLoop(size_t index) {
+    currentPool  = this;
+    currentQueue = index;
+
+    Task task;
+    for (;;) {
+        if (findTask(index, task)) {
+            TaskGroup *group = task.group();
+            task();
+            task = Task();
+            if (group)
+                group->done();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        sleeping_.fetch_add(1);
+        wake_.wait(lock, [this] { return stop_ || queued_.load() > 0; });
+        sleeping_.fetch_sub(1);
+        if (stop_ && queued_.load() == 0)
+            return;
+    }
+}
+
+TaskGroup::TaskGroup(ThreadPool& pool)
+    : pool_(pool)
+    , pending_(0) {
+}
+
+TaskGroup::~TaskGroup() {
+    wait();
+}
+
+void TaskGroup::wait() {
+    Task task;
+    while (pending_.load(std::memory_order_acquire) > 0 && pool_.findGroupTask(this, task)) {
+        task();
+        task = Task();
+        done();
+    }
+
+    // Always synchronize on the mutex, the last done() may still be holding it
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_.wait(lock, [this] { return pending_.load(std::memory_order_acquire) == 0; });
+}
+
+void TaskGroup::done() {
+    // Only the last task takes the lock, so wait() cannot return while it still holds it
+    size_t pending = pending_.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (pending_.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+            return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        finished_.notify_all();
+}
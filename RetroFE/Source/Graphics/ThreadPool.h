@@ -2,38 +2,176 @@
 #ifndef THREADPOOL_H
 #define THREADPOOL_H
 
-#include <vector>
-#include <queue>
-#include <thread>
-#include <mutex>
+#include <atomic>
 #include <condition_variable>
-#include <future>
+#include <cstddef>
 #include <functional>
-#include <stdexcept>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
 #include <type_traits> // Include for std::invoke_result
+#include <utility>
+#include <vector>
+
+class TaskGroup;
+
+// A type-erased callable. Lambdas capturing a few pointers are stored inline, so queueing
+// one does not allocate.
+class Task {
+public:
+    Task() = default;
+    template<class F>
+    explicit Task(F&& f, TaskGroup *group = nullptr);
+    Task(Task&& other) noexcept;
+    Task& operator=(Task&& other) noexcept;
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    ~Task();
+
+    void operator()() { ops_->run(storage_); }
+    explicit operator bool() const { return ops_ != nullptr; }
+    TaskGroup *group() const { return group_; }
+
+private:
+    static constexpr size_t inlineSize = 48;
+
+    struct Ops {
+        void (*run)(void *storage);
+        // Move-constructs into to and destroys from
+        void (*move)(void *from, void *to);
+        void (*destroy)(void *storage);
+    };
+
+    template<class F> struct InlineOps;
+    template<class F> struct HeapOps;
+
+    void reset();
 
+    alignas(std::max_align_t) unsigned char storage_[inlineSize];
+    const Ops *ops_ = nullptr;
+    TaskGroup *group_ = nullptr;
+};
+
+// One process-wide pool of workers, each with its own queue. A worker takes the newest
+// task from its own queue and steals the oldest from the others when it runs dry.
 class ThreadPool {
 public:
     explicit ThreadPool(size_t threads);
     ~ThreadPool();
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // The pool shared by page updates and asset loading, one worker less than there are
+    // cores since the waiting thread helps out
+    static ThreadPool &instance();
+    size_t size() const { return queues_.size(); }
 
     // Enqueue tasks to the thread pool
     template<class F, class... Args>
     auto enqueue(F&& f, Args&&... args)
         -> std::future<typename std::invoke_result_t<F, Args...>>;
 
+    // Queues f for a worker without a future, for work nobody waits on. A small lambda is
+    // stored in the task itself, so this does not allocate; f must not throw.
+    template<class F>
+    void submit(F&& f);
+
+    // Calls body(i) for every i in [begin, end), grain indices per task, and returns when
+    // all have run. The calling thread takes the last chunk itself.
+    template<class F>
+    void parallelFor(size_t begin, size_t end, F&& body, size_t grain = 1);
+
+private:
+    friend class TaskGroup;
+
+    // Ring buffer that only allocates when it has to grow
+    struct WorkQueue {
+        std::mutex mutex;
+        std::vector<Task> ring;
+        size_t head = 0;
+        size_t count = 0;
+
+        void push(Task&& task);
+        bool popBack(Task& task);
+        bool popFront(Task& task);
+        bool popGroup(TaskGroup *group, Task& task);
+    };
+
+    void schedule(Task&& task);
+    bool findTask(size_t index, Task& task);
+    bool findGroupTask(TaskGroup *group, Task& task);
+    void workerLoop(size_t index);
+
+    std::vector<std::unique_ptr<WorkQueue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> nextQueue_;
+    std::atomic<size_t> queued_;
+    std::atomic<size_t> sleeping_;
+
+    // Idle workers sleep here until a task is queued
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    std::atomic<bool> stop_;
+};
+
+// Tasks that can be waited on together without a future per task. Waiting runs the
+// group's tasks that no worker has picked up yet on the calling thread.
+class TaskGroup {
+public:
+    explicit TaskGroup(ThreadPool& pool = ThreadPool::instance());
+    ~TaskGroup();
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    template<class F>
+    void run(F&& f);
+    void wait();
+
 private:
-    // Worker threads
-    std::vector<std::thread> workers;
-    // Task queue
-    std::queue<std::function<void()>> tasks;
-
-    // Synchronization
-    std::mutex queueMutex;
-    std::condition_variable condition;
-    bool stop;
+    friend class ThreadPool;
+    void done();
+
+    ThreadPool& pool_;
+    std::atomic<size_t> pending_;
+    std::mutex mutex_;
+    std::condition_variable finished_;
+};
+
+template<class F>
+struct Task::InlineOps {
+    static void run(void *storage) { (*static_cast<F *>(storage))(); }
+    static void move(void *from, void *to) {
+        new (to) F(std::move(*static_cast<F *>(from)));
+        static_cast<F *>(from)->~F();
+    }
+    static void destroy(void *storage) { static_cast<F *>(storage)->~F(); }
+    static constexpr Ops ops = { run, move, destroy };
+};
+
+template<class F>
+struct Task::HeapOps {
+    static void run(void *storage) { (**static_cast<F **>(storage))(); }
+    static void move(void *from, void *to) { *static_cast<F **>(to) = *static_cast<F **>(from); }
+    static void destroy(void *storage) { delete *static_cast<F **>(storage); }
+    static constexpr Ops ops = { run, move, destroy };
 };
 
+template<class F>
+Task::Task(F&& f, TaskGroup *group) : group_(group) {
+    using Fn = std::decay_t<F>;
+    if constexpr (sizeof(Fn) <= inlineSize && alignof(Fn) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible_v<Fn>) {
+        new (storage_) Fn(std::forward<F>(f));
+        ops_ = &InlineOps<Fn>::ops;
+    }
+    else {
+        *reinterpret_cast<Fn **>(storage_) = new Fn(std::forward<F>(f));
+        ops_ = &HeapOps<Fn>::ops;
+    }
+}
+
 // Implementation of the enqueue method needs to be visible to all translation units that use it, hence defined in the header
 template<class F, class... Args>
 auto ThreadPool::enqueue(F&& f, Args&&... args)
@@ -45,16 +183,43 @@ auto ThreadPool::enqueue(F&& f, Args&&... args)
     );
 
     std::future<return_type> res = task->get_future();
-    {
-        std::unique_lock<std::mutex> lock(queueMutex);
+    schedule(Task([task] { (*task)(); }));
+    return res;
+}
 
-        if (stop)
-            throw std::runtime_error("enqueue on stopped ThreadPool");
+template<class F>
+void ThreadPool::parallelFor(size_t begin, size_t end, F&& body, size_t grain) {
+    if (begin >= end) {
+        return;
+    }
+    if (grain == 0) {
+        grain = 1;
+    }
 
-        tasks.emplace([task] { (*task)(); });
+    TaskGroup group(*this);
+    size_t first = begin;
+    while (end - first > grain) {
+        size_t last = first + grain;
+        group.run([&body, first, last] {
+            for (size_t i = first; i < last; ++i)
+                body(i);
+        });
+        first = last;
     }
-    condition.notify_one();
-    return res;
+    for (size_t i = first; i < end; ++i)
+        body(i);
+    group.wait();
+}
+
+template<class F>
+void TaskGroup::run(F&& f) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.schedule(Task(std::forward<F>(f), this));
+}
+
+template<class F>
+void ThreadPool::submit(F&& f) {
+    schedule(Task(std::forward<F>(f)));
 }
 
 #endif // THREADPOOL_H
@@ -19,6 +19,7 @@
 #include "Database/DB.h"
 #include "Database/GlobalOpts.h"
 #include "Collection/CollectionInfoBuilder.h"
+#include "Execute/Benchmark.h"
 #include "Execute/Launcher.h"
 #include "Utility/Log.h"
 #include "Utility/Utils.h"
@@ -116,6 +117,8 @@ int main(int argc, char** argv)
     Configuration::initialize();
     Configuration config;
     std::string dbPath = Utils::combinePath(Configuration::absolutePath, "meta.db");
+    Benchmark* benchmark = nullptr;
+    std::string benchmarkResults;
 
     // Check to see if an argument was passed
     if (argc > 1)
@@ -222,6 +225,25 @@ int main(int argc, char** argv)
             sendEnterKey();
             return 0;
         }
+        else if ((param == "-benchmark" ||
+            param == "--benchmark" ||
+            param == "-bench") && (argc == 3 || argc == 4)) {
+            // Replay a script headless: no window, no GPU, results as JSON
+            benchmark = new Benchmark(argv[2]);
+            if (!benchmark->load(settingsFromCLI)) {
+                std::cout << std::endl << "Could not load benchmark script " << argv[2] << std::endl;
+                return 1;
+            }
+            if (argc == 4) {
+                benchmarkResults = argv[3];
+            }
+            settingsFromCLI.push_back(std::string(OPTION_FULLSCREEN) + "=no\n");
+            settingsFromCLI.push_back(std::string(OPTION_SDLRENDERDRIVER) + "=software\n");
+            // Environment settings win, so a benchmark can still be watched in a real window
+            SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+            SDL_setenv("SDL_AUDIODRIVER", "dummy", 0);
+            SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+        }
         else if ((argc % 2 != 0 || argc % 2 == 0) && param != "-help" && param != "-h" && param != "--help") {
             // Pass global settings via CLI
             for (int i = 1; i <= argc - 1 ; i+=2) {
@@ -282,6 +304,7 @@ int main(int argc, char** argv)
             std::cout << "  -sc  -showconfig         Print a list of current settings" << std::endl;
             std::cout << "  -C   -createconfig       Create a settings.conf with default values and a readme" << std::endl;
             std::cout << "       -dump               Dump current settings to properties.txt" << std::endl;
+            std::cout << "       -benchmark          Replay a benchmark script headless, print timings as JSON  [script] {results.json}" << std::endl;
             std::cout << std::endl;
 
             // Provide additional information and references
@@ -318,6 +341,7 @@ int main(int argc, char** argv)
                 exit(EXIT_FAILURE);
             }
             RetroFE p(config);
+            p.setBenchmark(benchmark);
             if (p.run()) // Check if we need to reboot after running
                 config.clearProperties();
             else
@@ -328,9 +352,17 @@ int main(int argc, char** argv)
         LOG_ERROR("EXCEPTION", e.what());
     }
 
+    int exitCode = 0;
+    if (benchmark) {
+        if (!benchmark->writeResults(benchmarkResults) || !benchmark->isDone()) {
+            exitCode = 1;
+        }
+        delete benchmark;
+    }
+
     Logger::deInitialize();
 
-    return 0;
+    return exitCode;
 }
 
 static bool ImportConfiguration(Configuration* c) {
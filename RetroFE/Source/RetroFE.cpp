@@ -21,6 +21,7 @@
 #include "Database/Configuration.h"
 #include "Database/GlobalOpts.h"
 #include "Collection/Item.h"
+#include "Execute/Benchmark.h"
 #include "Execute/Launcher.h"
 #include "Menu/Menu.h"
 #include "Utility/Log.h"
@@ -32,8 +33,12 @@
 #include "Graphics/Page.h"
 #include "Graphics/Component/ScrollingList.h"
 #include <gst/gst.h>
+#include "Video/PosterCache.h"
 #include "Video/VideoFactory.h"
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
 #include <fstream>
 #include <sstream>
 #include <string>
@@ -99,16 +104,113 @@ RetroFE::~RetroFE( )
 // Render the current page to the screen
 void RetroFE::render()
 {
+    SDL::beginFrame();
+    {
+        FrameProfiler::Scope draw(FrameProfiler::PhaseDraw);
+        for (int i = 0; i < SDL::getScreenCount(); ++i) {
+            SDL_SetRenderDrawColor(SDL::getRenderer(i), 0x0, 0x0, 0x00, 0xFF);
+            SDL_RenderClear(SDL::getRenderer(i));
+        }
+        if (currentPage_) { currentPage_->draw(); }
+    }
+    if (FrameProfiler::isEnabled()) { drawProfilerOverlay(); }
+    {
+        FrameProfiler::Scope present(FrameProfiler::PhasePresent);
+        SDL::endFrame();
+        for (int i = 0; i < SDL::getScreenCount(); ++i) { SDL_RenderPresent(SDL::getRenderer(i)); }
+    }
+
+}
+
+// Draws text with the glyphs of an atlas font, returns the x position after the last glyph
+static float drawOverlayText(Font *font, SDL_Texture *texture, const std::string &text, float x, float y, float scale, ViewInfo &view, int layoutWidth, int layoutHeight)
+{
+    for (unsigned char c : text) {
+        Font::GlyphInfo glyph;
+        if (!font->getRect(c, glyph) || glyph.rect.h <= 0) {
+            continue;
+        }
+        SDL_Rect rect;
+        rect.x = static_cast<int>(x + static_cast<float>(std::min(glyph.minX, 0)) * scale);
+        rect.y = static_cast<int>(y + static_cast<float>(std::min(font->getAscent() - glyph.maxY, 0)) * scale);
+        rect.w = static_cast<int>(static_cast<float>(glyph.rect.w) * scale);
+        rect.h = static_cast<int>(static_cast<float>(glyph.rect.h) * scale);
+        SDL::renderCopy(texture, 1.0f, &glyph.rect, &rect, view, layoutWidth, layoutHeight);
+        x += static_cast<float>(glyph.advance) * scale;
+    }
+    return x;
+}
+
+// Frame profiler results in the top left corner of the first monitor, drawn with the
+// layout font: min, average and 99th percentile milliseconds per phase
+void RetroFE::drawProfilerOverlay()
+{
+    Font *font = currentPage_ ? currentPage_->getOverlayFont() : nullptr;
+    if (!font) {
+        return;
+    }
+
+    // Percentiles are recomputed twice a second rather than every frame
+    if (profilerStats_.empty() || SDL_GetTicks() - profilerStatsTime_ > 500) {
+        profilerFrames_    = FrameProfiler::summary(profilerStats_);
+        profilerStatsTime_ = SDL_GetTicks();
+    }
+    if (profilerStats_.empty()) {
+        return;
+    }
+
+    int   layoutWidth  = currentPage_->getLayoutWidthByMonitor(0);
+    int   layoutHeight = currentPage_->getLayoutHeightByMonitor(0);
+    float fontSize     = static_cast<float>(layoutHeight) / 40;
+    Font *sized        = font->getSizedFont(fontSize * currentPage_->getScreenScaleByMonitor(0));
+    if (sized->getHeight() <= 0) {
+        return;
+    }
+    float scale  = fontSize / static_cast<float>(sized->getHeight());
+    float column = fontSize * 4;
+
+    std::vector<std::vector<std::string>> rows;
+    rows.push_back({ std::to_string(profilerFrames_) + " frames", "min", "avg", "p99" });
+    for (const FrameProfiler::Stats &phase : profilerStats_) {
+        char value[3][16];
+        snprintf(value[0], sizeof(value[0]), "%.2f", phase.min);
+        snprintf(value[1], sizeof(value[1]), "%.2f", phase.avg);
+        snprintf(value[2], sizeof(value[2]), "%.2f", phase.p99);
+        rows.push_back({ phase.name, value[0], value[1], value[2] });
+    }
 
-    SDL_LockMutex(SDL::getMutex());
-    for (int i = 0; i < SDL::getScreenCount(); ++i) {
-        SDL_SetRenderDrawColor(SDL::getRenderer(i), 0x0, 0x0, 0x00, 0xFF);
-        SDL_RenderClear(SDL::getRenderer(i));
+    ViewInfo view;
+    // A dark pass offset by a couple of pixels keeps the text readable on any background
+    for (int pass = 0; pass < 2; ++pass) {
+        SDL_Texture *texture = sized->getTexture();
+        if (!texture) {
+            return;
+        }
+        if (pass == 0) {
+            SDL_SetTextureColorMod(texture, 0, 0, 0);
+        }
+        float offset = (pass == 0) ? fontSize / 10 : 0;
+        float y      = fontSize / 2 + offset;
+        for (const std::vector<std::string> &row : rows) {
+            float x = fontSize / 2 + offset;
+            for (size_t i = 0; i < row.size(); ++i) {
+                drawOverlayText(sized, texture, row[i], x, y, scale, view, layoutWidth, layoutHeight);
+                x += (i == 0) ? column * 1.5f : column;
+            }
+            y += fontSize;
+        }
     }
-    if (currentPage_) { currentPage_->draw(); }
-    for (int i = 0; i < SDL::getScreenCount(); ++i) { SDL_RenderPresent(SDL::getRenderer(i)); }
-    SDL_UnlockMutex(SDL::getMutex());
+}
 
+void RetroFE::dumpProfiler()
+{
+    std::string file = Utils::combinePath(Configuration::absolutePath, "frameprofile-" + std::to_string(time(nullptr)) + ".csv");
+    if (FrameProfiler::writeCsv(file)) {
+        LOG_INFO("RetroFE", "Frame profile written to " + file);
+    }
+    else {
+        LOG_ERROR("RetroFE", "Could not write frame profile to " + file);
+    }
 }
 
 
@@ -153,6 +255,8 @@ void RetroFE::launchEnter( )
     bool unloadSDL = false;
     config_.getProperty( OPTION_UNLOADSDL, unloadSDL );
     if ( unloadSDL ) { freeGraphicsMemory(); }
+    // Idle pipelines may hold the audio device the game wants
+    VideoFactory::clearPool( );
     // If on MacOS disable relative mouse mode to handoff mouse to game/program
     #ifdef __APPLE__
         SDL_SetRelativeMouseMode(SDL_FALSE);
@@ -193,7 +297,8 @@ void RetroFE::launchExit( )
     currentPage_->reallocateMenuSpritePoints(false); // skip updating playlist menu
 
     // Restore time settings
-    currentTime_ = static_cast<float>( SDL_GetTicks( ) ) / 1000;
+    pacer_.reset( );
+    currentTime_ = pacer_.now( );
     keyLastTime_ = currentTime_;
     lastLaunchReturnTime_ = currentTime_;
 
@@ -226,6 +331,7 @@ void RetroFE::freeGraphicsMemory()
         if (currentPage_) {
             currentPage_->deInitializeFonts();
         }
+        fontcache_.deInitializeFonts();
 
         SDL::deInitialize();
         input_.clearJoysticks();
@@ -287,6 +393,7 @@ bool RetroFE::deInitialize( )
     }
     else {
         LOG_INFO("RetroFE", "Exiting" );
+        VideoFactory::clearPool( );
         SDL::deInitialize( );
         gst_deinit( );
     }
@@ -338,15 +445,44 @@ bool RetroFE::run( )
         return false;
     }
 
-    float preloadTime = 0;
+    double preloadTime = 0;
 
     // Initialize video
-    bool videoEnable = true;
-    int  videoLoop   = 0;
+    bool videoEnable     = true;
+    int  videoLoop       = 0;
+    int  videoPoolSize   = 4;
+    int  videoPreroll    = 2;
+    bool videoPosters    = true;
+    int  videoMaxDecodes = 0;
     config_.getProperty( OPTION_VIDEOENABLE, videoEnable );
     config_.getProperty( OPTION_VIDEOLOOP, videoLoop );
+    config_.getProperty( OPTION_VIDEOPOOLSIZE, videoPoolSize );
+    config_.getProperty( OPTION_VIDEOPREROLL, videoPreroll );
+    config_.getProperty( OPTION_VIDEOPOSTERS, videoPosters );
+    config_.getProperty( OPTION_VIDEOMAXDECODES, videoMaxDecodes );
     VideoFactory::setEnabled( videoEnable );
     VideoFactory::setNumLoops( videoLoop );
+    VideoFactory::setPoolSize( videoPoolSize );
+    VideoFactory::setPrerollCount( videoPreroll );
+    VideoFactory::setMaxDecodes( videoMaxDecodes );
+    PosterCache::setEnabled( videoPosters );
+
+    // Seed random choices (random item, attract mode timing) before anything loads, so a
+    // replay makes the same choices as the session it replays
+    std::string recordInput;
+    std::string replayInput;
+    config_.getProperty( OPTION_RECORDINPUT, recordInput );
+    config_.getProperty( OPTION_REPLAYINPUT, replayInput );
+    unsigned int seed = static_cast<unsigned int>( time( nullptr ) );
+    if ( !replayInput.empty( ) ) {
+        if ( !recorder_.replay( Utils::combinePath( Configuration::absolutePath, replayInput ), seed ) )
+            return false;
+        input_.setReplaying( true );
+    }
+    else if ( !recordInput.empty( ) ) {
+        recorder_.record( Utils::combinePath( Configuration::absolutePath, recordInput ), seed );
+    }
+    srand( seed );
 
     initializeThread = SDL_CreateThread( initialize, "RetroFEInit", (void *)this );
 
@@ -387,10 +523,25 @@ bool RetroFE::run( )
     int fpsIdle = 60;
     config_.getProperty( OPTION_FPS, fps );
     config_.getProperty( OPTION_FPSIDLE, fpsIdle );
-    double fpsTime     = 1000.0 / static_cast<double>(fps);
-    double fpsIdleTime = 1000.0 / static_cast<double>(fpsIdle);
+    double fpsTime     = 1.0 / static_cast<double>(fps);
+    double fpsIdleTime = 1.0 / static_cast<double>(fpsIdle);
 	bool vSync = false;
 	config_.getProperty( OPTION_VSYNC, vSync);
+    bool renderOnDemand = false;
+    config_.getProperty( OPTION_RENDERONDEMAND, renderOnDemand );
+    bool profiler = false;
+    config_.getProperty( OPTION_PROFILER, profiler );
+    FrameProfiler::setEnabled( profiler );
+    // Benchmarks and replays measure unthrottled frames and never skip one
+    if ( benchmark_ || recorder_.isReplaying( ) ) {
+        vSync          = false;
+        renderOnDemand = false;
+        fpsTime        = 0;
+        fpsIdleTime    = 0;
+    }
+    bool   lastFrameStatic = false;
+    double idleSince       = 0;
+    int    idleUpdates     = 0;
 
     int initializeStatus = 0;
     bool inputClear      = false;
@@ -399,14 +550,15 @@ bool RetroFE::run( )
     currentPage_        = loadSplashPage( );
     state               = RETROFE_ENTER;
     bool splashMode     = true;
-    bool exitSplashMode = false;
+    // A benchmark does not wait out the splash screen
+    bool exitSplashMode = benchmark_ != nullptr;
     // don't show splash 
     bool screensaver = false;
     config_.getProperty(OPTION_SCREENSAVER, screensaver);
 
     Launcher l( config_ );
     Menu     m( config_, input_ );
-    preloadTime = static_cast<float>( SDL_GetTicks( ) ) / 1000;
+    preloadTime = pacer_.now( );
 
     l.LEDBlinky( 1 );
     l.startScript();
@@ -423,12 +575,10 @@ bool RetroFE::run( )
         config_.setProperty("settingsPlaylist", settingsPlaylist);
     }
 
-    float lastTime = 0;
-    float deltaTime = 0;
+    double deltaTime = 0;
 
     while ( running ) {
 
-        lastTime = 0;
         deltaTime = 0;
 
         // Exit splash mode when an active key is pressed
@@ -1690,28 +1840,23 @@ bool RetroFE::run( )
 		
         // Handle screen updates and attract mode
         if ( running ) {
-            lastTime = currentTime_;
-            currentTime_ = static_cast<float>( SDL_GetTicks( ) ) / 1000;
-
-            if ( currentTime_ < lastTime ) {
-                currentTime_ = lastTime;
+            // With vsync the present call already paces the loop
+            if ( vSync )
+                pacer_.setPeriod( 0 );
+            else
+                pacer_.setPeriod( state == RETROFE_IDLE ? fpsIdleTime : fpsTime );
+            {
+                FrameProfiler::Scope pacing( FrameProfiler::PhasePacing );
+                deltaTime = pacer_.tick( );
+            }
+            currentTime_ = pacer_.now( );
+            if ( !recorder_.beginFrame( currentTime_, deltaTime ) && state == RETROFE_IDLE ) {
+                state = RETROFE_QUIT_REQUEST;
             }
 
-            deltaTime = currentTime_ - lastTime;
-            double sleepTime;
-			if (state == RETROFE_IDLE)
-                sleepTime = fpsIdleTime - deltaTime*1000;
-            else
-                sleepTime = fpsTime - deltaTime*1000;
-            if ( sleepTime > 0 && sleepTime < 1000 ) {
-				if (vSync == false) {
-					SDL_Delay( static_cast<unsigned int>( sleepTime ) );
-				}
-			}
-		
             if ( currentPage_ ) {
                 if (!splashMode && !paused_) {
-                    int attractReturn = attract_.update( deltaTime, *currentPage_ );
+                    int attractReturn = attract_.update( static_cast<float>( deltaTime ), *currentPage_ );
                     if (!kioskLock_ && attractReturn == 1) // Change playlist
                     {
                         attract_.reset( attract_.isSet( ) );
@@ -1743,9 +1888,23 @@ bool RetroFE::run( )
                 if ( menuMode_ ) {
                     attract_.reset( );
                 }
-                currentPage_->update( deltaTime );
-                SDL_PumpEvents( );
-                input_.updateKeystate( );
+                {
+                    FrameProfiler::Scope update( FrameProfiler::PhaseUpdate );
+                    currentPage_->update( deltaTime );
+                    VideoFactory::govern( );
+                }
+                {
+                    FrameProfiler::Scope input( FrameProfiler::PhaseInput );
+                    SDL_PumpEvents( );
+                    input_.updateKeystate( );
+                    recorder_.syncInput( input_ );
+                }
+                if ( benchmark_ ) {
+                    benchmark_->update( input_, state == RETROFE_IDLE && !splashMode && currentPage_->isIdle( ), deltaTime );
+                    if ( benchmark_->isDone( ) && state == RETROFE_IDLE ) {
+                        state = RETROFE_QUIT_REQUEST;
+                    }
+                }
                 if (!splashMode && !paused_) {
                     if ( currentPage_->isAttractIdle( ) ) {
                         if ( !attractMode_ && attract_.isSet( ) ) {
@@ -1770,12 +1929,57 @@ bool RetroFE::run( )
                 }
             }
 
-            render( );
+            // Skip the redraw when neither this nor the previous update changed the picture,
+            // and sleep until input arrives or the next timed event (attract mode, clock) is due
+            // A window that was exposed, resized or restored needs drawing whatever the page does
+            bool frameStatic = renderOnDemand && state == RETROFE_IDLE && !splashMode && currentPage_ &&
+                               !windowChanged_ && !input_.anyKeyPressed( ) && !currentPage_->isAnimating( );
+            windowChanged_ = false;
+            if ( benchmark_ )
+                Benchmark::frameDrawn( !( frameStatic && lastFrameStatic ) );
+            if ( frameStatic && lastFrameStatic ) {
+                if ( idleUpdates++ == 0 )
+                    idleSince = currentTime_;
+                // Textures other threads let go of are only freed on the render thread
+                SDL::runRenderCommands( );
+                SDL_WaitEventTimeout( nullptr, idleWaitTime( ) );
+            }
+            else {
+                if ( idleUpdates > 0 && Logger::isLevelEnabled("DEBUG") ) {
+                    double idle = currentTime_ - idleSince;
+                    LOG_DEBUG("RetroFE", "Idle for " + std::to_string( idle ) + "s with " + std::to_string( idleUpdates ) + " updates and no redraws");
+                }
+                idleUpdates = 0;
+                render( );
+            }
+            lastFrameStatic = frameStatic;
+            FrameProfiler::endFrame( );
         }
     }
+    if ( Logger::isLevelEnabled("DEBUG") )
+        LOG_DEBUG("RetroFE", "Frame times:\n" + pacer_.histogram( ));
+    recorder_.close( );
     return reboot_;
 }
 
+// Milliseconds an idle, unchanged frame may sleep: until the attract timer fires or the
+// wall clock reaches the next second, so time text stays current
+int RetroFE::idleWaitTime( )
+{
+    auto  now          = std::chrono::system_clock::now( ).time_since_epoch( );
+    int   toNextSecond = 1000 - static_cast<int>( std::chrono::duration_cast<std::chrono::milliseconds>( now ).count( ) % 1000 );
+    float toAttract    = attract_.timeToNextEvent( *currentPage_ ) * 1000;
+    if ( toAttract < toNextSecond )
+        return static_cast<int>( toAttract ) + 1;
+    return toNextSecond + 1;
+}
+
+
+void RetroFE::setBenchmark( Benchmark *benchmark )
+{
+    benchmark_ = benchmark;
+}
+
 bool RetroFE::getAttractModeCyclePlaylist()
 {
     bool attractModeCyclePlaylist = true;
@@ -1910,6 +2114,8 @@ void RetroFE::goToNextAttractModePlaylistByCycle(std::vector<std::string> cycleV
 // Process the user input
 RetroFE::RETROFE_STATE RetroFE::processUserInput( Page *page )
 {
+    FrameProfiler::Scope profile( FrameProfiler::PhaseInput );
+
     bool screensaver = false;
     config_.getProperty(OPTION_SCREENSAVER, screensaver);
 
@@ -1932,6 +2138,8 @@ RetroFE::RETROFE_STATE RetroFE::processUserInput( Page *page )
     // Poll all events until we find an active one
     SDL_Event e;
     while ( SDL_PollEvent( &e ) ) {
+        if ( e.type == SDL_WINDOWEVENT )
+            windowChanged_ = true;
         // some how !SDL_KEYUP prevents double action
         input_.update(e);
         if (e.type == SDL_POLLSENTINEL || (screensaver && ssExitInputs[e.type])) {
@@ -2297,6 +2505,17 @@ RetroFE::RETROFE_STATE RetroFE::processUserInput( Page *page )
             }
             buildInfo_ = !buildInfo_;
         }
+        else if (input_.keystate(UserInput::KeyCodeToggleProfiler)) {
+            input_.resetStates();
+            keyLastTime_ = currentTime_;
+            FrameProfiler::setEnabled(!FrameProfiler::isEnabled());
+            profilerStats_.clear();
+        }
+        else if (input_.keystate(UserInput::KeyCodeDumpProfiler)) {
+            input_.resetStates();
+            keyLastTime_ = currentTime_;
+            dumpProfiler();
+        }
 
         else if ( input_.keystate(UserInput::KeyCodeSkipForward) ) {
             attract_.reset( );
@@ -2488,6 +2707,7 @@ Page *RetroFE::loadSplashPage( )
 // Load a collection
 CollectionInfo* RetroFE::getCollection(const std::string& collectionName)
 {
+    Uint64 buildStart = SDL_GetPerformanceCounter();
 
     // Check if subcollections should be merged or split
     bool subsSplit = false;
@@ -2613,6 +2833,9 @@ CollectionInfo* RetroFE::getCollection(const std::string& collectionName)
         }
     }
 
+    if ( Benchmark::isActive( ) ) {
+        Benchmark::collectionBuilt( collectionName, static_cast<double>( SDL_GetPerformanceCounter( ) - buildStart ) / static_cast<double>( SDL_GetPerformanceFrequency( ) ) );
+    }
 
     return collection;
 }
@@ -17,6 +17,7 @@
 
 
 #include "Collection/Item.h"
+#include "Control/InputRecorder.h"
 #include "Control/UserInput.h"
 #include "Database/DB.h"
 #include "Database/MetadataDatabase.h"
@@ -36,11 +37,14 @@
 #include <map>
 #include <string>
 #include "Graphics/Page.h"
+#include "Utility/FramePacer.h"
+#include "Utility/FrameProfiler.h"
 #ifdef WIN32
     #include <Windows.h>
 #endif
 
 
+class Benchmark;
 class CollectionInfo;
 class Configuration;
 class Page;
@@ -61,6 +65,7 @@ public:
     std::vector<std::string>     getPlaylistCycle();
     void selectRandomOnFirstCycle();
     bool getAttractModeCyclePlaylist();
+    void setBenchmark( Benchmark *benchmark );
 
 
 private:
@@ -141,6 +146,9 @@ private:
     };
 
     void            render();
+    void            drawProfilerOverlay( );
+    void            dumpProfiler( );
+    int             idleWaitTime( );
     bool            back( bool &exit );
     bool isStandalonePlaylist(std::string playlist);
     bool isInAttractModeSkipPlaylist(std::string playlist);
@@ -170,10 +178,17 @@ private:
     
     std::stack<Page *> pages_;
     float              keyInputDisable_;
-    float              currentTime_;
-    float              lastLaunchReturnTime_;
-    float              keyLastTime_;
+    double             currentTime_;
+    double             lastLaunchReturnTime_;
+    double             keyLastTime_;
     float              keyDelayTime_;
+    FramePacer         pacer_;
+    std::vector<FrameProfiler::Stats> profilerStats_;
+    size_t             profilerFrames_{ 0 };
+    Uint32             profilerStatsTime_{ 0 };
+    Benchmark         *benchmark_{ nullptr };
+    bool               windowChanged_{ false };
+    InputRecorder      recorder_;
     Item              *nextPageItem_;
     FontCache          fontcache_;
     AttractMode        attract_;
@@ -18,6 +18,8 @@
 #include "SDL.h"
 #include "Database/Configuration.h"
 #include "Database/GlobalOpts.h"
+#include "Graphics/ThreadPool.h"
+#include "Utility/FrameProfiler.h"
 #include "Utility/Log.h"
 #if (__APPLE__)
     #include <SDL2_mixer/SDL_mixer.h>
@@ -28,7 +30,8 @@
 
 std::vector<SDL_Window *>   SDL::window_;
 std::vector<SDL_Renderer *> SDL::renderer_;
-SDL_mutex                  *SDL::mutex_ = nullptr;
+std::atomic<SDL::RenderCommand *> SDL::renderCommands_(nullptr);
+std::atomic<std::thread::id> SDL::renderThread_;
 std::vector<int>            SDL::displayWidth_;
 std::vector<int>            SDL::displayHeight_;
 std::vector<int>            SDL::windowWidth_;
@@ -39,6 +42,11 @@ std::vector<bool>           SDL::mirror_;
 int                         SDL::numScreens_ = 1;
 int                         SDL::numDisplays_ = 1;
 int                         SDL::screenCount_;
+std::vector<SDL::MonitorTransform> SDL::transform_;
+std::vector<bool>           SDL::composite_;
+std::vector<SDL_Texture *>  SDL::compositeTexture_;
+std::vector<bool>           SDL::compositeActive_;
+std::vector<bool>           SDL::capture_;
 
 // Initialize SDL
 bool SDL::initialize( Configuration &config )
@@ -220,6 +228,12 @@ bool SDL::initialize( Configuration &config )
                 LOG_INFO("Configuration", "Setting mirror mode for screen " + screenIndex + "." );
             mirror_.push_back( mirror );
 
+            bool composite = false;
+            config.getProperty( OPTION_COMPOSITE + screenIndex, composite );
+            if ( composite )
+                LOG_INFO("Configuration", "Setting composition mode for screen " + screenIndex + "." );
+            composite_.push_back( composite );
+
             window_.push_back(NULL);
             renderer_.push_back(NULL);
             std::string fullscreenStr = fullscreen_[screenNum] ? "yes" : "no";
@@ -317,14 +331,22 @@ bool SDL::initialize( Configuration &config )
         }
     }
 
-    mutex_ = SDL_CreateMutex( );
-
-    if ( mutex_ == nullptr ) {
-        std::string error = SDL_GetError( );
-        LOG_ERROR("SDL", "Mutex creation failed: " + error );
-        return false;
+    transform_.assign( screenCount_, MonitorTransform( ) );
+    compositeTexture_.assign( screenCount_, nullptr );
+    compositeActive_.assign( screenCount_, false );
+    capture_.assign( screenCount_, false );
+    for ( int i = 0; i < screenCount_; ++i ) {
+        if ( window_[i] )
+            SDL_GetWindowSize( window_[i], &windowWidth_[i], &windowHeight_[i] );
+        if ( composite_[i] && renderer_[i] && !SDL_RenderTargetSupported( renderer_[i] ) ) {
+            LOG_WARNING("SDL", "Renderer " + std::to_string( i ) + " does not support render targets; composition mode disabled." );
+            composite_[i] = false;
+        }
     }
 
+    // Until a frame is drawn, the thread that created the renderers owns them
+    renderThread_ = std::this_thread::get_id( );
+
     if ( Mix_OpenAudio( audioRate, audioFormat, audioChannels, audioBuffers ) == -1 ) {
         std::string error = Mix_GetError( );
         LOG_WARNING("SDL", "Audio initialize failed: " + error );
@@ -356,12 +378,18 @@ bool SDL::deInitialize( )
     Mix_CloseAudio( );
     Mix_Quit( );
 
-    if ( mutex_ ) {
-        SDL_DestroyMutex(mutex_);
-        mutex_ = nullptr;
-    }
+    // Textures queued for release must go before their renderers
+    runRenderCommands( );
 
     
+    for ( SDL_Texture *texture : compositeTexture_ ) {
+        if ( texture )
+            SDL_DestroyTexture( texture );
+    }
+    compositeTexture_.clear( );
+    compositeActive_.clear( );
+    capture_.clear( );
+
     for ( int i = 0; i < screenCount_; ++i ) {
         if ( !renderer_.empty() ) {
             if ( renderer_[0] ) {
@@ -382,6 +410,8 @@ bool SDL::deInitialize( )
     windowWidth_.clear( );
     windowHeight_.clear( );
     fullscreen_.clear( );
+    transform_.clear( );
+    composite_.clear( );
 
     SDL_ShowCursor( SDL_TRUE );
 
@@ -411,10 +441,58 @@ std::string SDL::getRendererBackend(int index) {
     return std::string(info.name);
 }
 
-// Get the mutex
-SDL_mutex* SDL::getMutex( )
+struct SDL::RenderCommand
 {
-    return mutex_;
+    Task           task;
+    RenderCommand *next;
+};
+
+
+bool SDL::isRenderThread( )
+{
+    return renderThread_.load( std::memory_order_relaxed ) == std::this_thread::get_id( );
+}
+
+
+// Run now on the render thread, otherwise push onto a lock-free stack for the next frame
+void SDL::runOnRenderThread( Task &&command )
+{
+    if ( isRenderThread( ) ) {
+        command( );
+        return;
+    }
+
+    RenderCommand *node = new RenderCommand{ std::move( command ), renderCommands_.load( std::memory_order_relaxed ) };
+    while ( !renderCommands_.compare_exchange_weak( node->next, node, std::memory_order_release, std::memory_order_relaxed ) ) {
+    }
+}
+
+
+void SDL::destroyTexture( SDL_Texture *texture )
+{
+    if ( texture ) {
+        runOnRenderThread( Task( [texture]( ) { SDL_DestroyTexture( texture ); } ) );
+    }
+}
+
+
+// Run the queued commands in the order they were submitted
+void SDL::runRenderCommands( )
+{
+    RenderCommand *node = renderCommands_.exchange( nullptr, std::memory_order_acquire );
+    RenderCommand *ordered = nullptr;
+    while ( node ) {
+        RenderCommand *next = node->next;
+        node->next = ordered;
+        ordered    = node;
+        node       = next;
+    }
+    while ( ordered ) {
+        RenderCommand *next = ordered->next;
+        ordered->task( );
+        delete ordered;
+        ordered = next;
+    }
 }
 
 
@@ -425,6 +503,220 @@ SDL_Window* SDL::getWindow( int index )
 }
 
 
+// Run the queued texture work and refresh the window sizes once per frame; invalidates
+// the cached transforms on a resize
+void SDL::beginFrame( )
+{
+    // Whichever thread draws owns the renderers, the launcher hands them to its own thread
+    renderThread_ = std::this_thread::get_id( );
+    {
+        FrameProfiler::Scope commands( FrameProfiler::PhaseCommands );
+        runRenderCommands( );
+    }
+
+    for ( int i = 0; i < screenCount_; ++i ) {
+        if ( !window_[i] )
+            continue;
+        int width  = 0;
+        int height = 0;
+        SDL_GetWindowSize( window_[i], &width, &height );
+        if ( width != windowWidth_[i] || height != windowHeight_[i] ) {
+            windowWidth_[i]           = width;
+            windowHeight_[i]          = height;
+            transform_[i].layoutWidth = 0;
+        }
+    }
+}
+
+
+// Blit the composition textures drawn this frame to their windows
+void SDL::endFrame( )
+{
+    for ( int i = 0; i < screenCount_; ++i ) {
+        if ( !compositeActive_[i] )
+            continue;
+        compositeActive_[i] = false;
+        SDL_SetRenderTarget( renderer_[i], nullptr );
+
+        int width  = 0;
+        int height = 0;
+        SDL_QueryTexture( compositeTexture_[i], nullptr, nullptr, &width, &height );
+        MonitorTransform transform = windowTransform( i, width, height );
+        SDL_Rect srcRect = { 0, 0, width, height };
+        SDL_Rect dstRect = { transform.offsetX, transform.offsetY, width, height };
+        renderTransformed( compositeTexture_[i], 255, srcRect, dstRect, 0, SDL_FLIP_NONE, i, transform );
+    }
+}
+
+
+// Redirect drawing on a monitor to its layout sized composition texture
+void SDL::beginComposite( int monitor, int layoutWidth, int layoutHeight )
+{
+    SDL_Texture *&texture = compositeTexture_[monitor];
+    int width  = 0;
+    int height = 0;
+    if ( texture )
+        SDL_QueryTexture( texture, nullptr, nullptr, &width, &height );
+    if ( width != layoutWidth || height != layoutHeight ) {
+        if ( texture )
+            SDL_DestroyTexture( texture );
+        texture = SDL_CreateTexture( renderer_[monitor], SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, layoutWidth, layoutHeight );
+        if ( !texture ) {
+            LOG_ERROR("SDL", "Could not create composition texture for screen " + std::to_string( monitor ) + ": " + SDL_GetError( ) );
+            composite_[monitor]             = false;
+            transform_[monitor].layoutWidth = 0;
+            return;
+        }
+        SDL_SetTextureBlendMode( texture, SDL_BLENDMODE_NONE );
+    }
+
+    SDL_SetRenderTarget( renderer_[monitor], texture );
+    SDL_SetRenderDrawColor( renderer_[monitor], 0x0, 0x0, 0x0, 0xFF );
+    SDL_RenderClear( renderer_[monitor] );
+    compositeActive_[monitor] = true;
+}
+
+
+// Redirect drawing on a monitor into a layout sized texture, e.g. to cache static layers.
+// The texture is cleared to opaque black, like the window it stands in for.
+bool SDL::beginCapture( int monitor, SDL_Texture *texture )
+{
+    if ( monitor >= screenCount_ || !renderer_[monitor] || SDL_SetRenderTarget( renderer_[monitor], texture ) != 0 )
+        return false;
+
+    SDL_SetRenderDrawColor( renderer_[monitor], 0x0, 0x0, 0x0, 0xFF );
+    SDL_RenderClear( renderer_[monitor] );
+    capture_[monitor] = true;
+    return true;
+}
+
+
+// Return drawing on a monitor to the window, or to its composition texture if one is in use
+void SDL::endCapture( int monitor )
+{
+    if ( monitor >= screenCount_ || !capture_[monitor] )
+        return;
+
+    capture_[monitor] = false;
+    SDL_SetRenderTarget( renderer_[monitor], compositeActive_[monitor] ? compositeTexture_[monitor] : nullptr );
+}
+
+
+// Compute the mapping of a layout onto the window of a monitor
+SDL::MonitorTransform SDL::windowTransform( int monitor, int layoutWidth, int layoutHeight )
+{
+    MonitorTransform transform;
+    transform.layoutWidth  = layoutWidth;
+    transform.layoutHeight = layoutHeight;
+    transform.scaleX       = (float)windowWidth_[monitor]  / (float)layoutWidth;
+    transform.scaleY       = (float)windowHeight_[monitor] / (float)layoutHeight;
+
+    // 90 or 270 degree rotation; change scale factors
+    if ( rotation_[monitor] % 2 == 1 ) {
+        transform.scaleX = (float)windowHeight_[monitor] / (float)layoutWidth;
+        transform.scaleY = (float)windowWidth_[monitor]  / (float)layoutHeight;
+    }
+
+    if ( mirror_[monitor] )
+        transform.scaleY /= 2;
+
+    if ( fullscreen_[monitor] ) {
+        transform.offsetX = (displayWidth_[monitor] - windowWidth_[monitor])/2;
+        transform.offsetY = (displayHeight_[monitor] - windowHeight_[monitor])/2;
+    }
+    else {
+        transform.offsetX = 0;
+        transform.offsetY = 0;
+    }
+
+    transform.rotation = rotation_[monitor];
+    transform.mirror   = mirror_[monitor];
+    transform.identity = transform.rotation == 0 && !transform.mirror;
+
+    return transform;
+}
+
+
+// Get the transform sprites are drawn with, recomputing it when the layout size changed.
+// Composited monitors draw at layout size; the window mapping is applied in endFrame.
+const SDL::MonitorTransform &SDL::getTransform( int monitor, int layoutWidth, int layoutHeight )
+{
+    MonitorTransform &transform = transform_[monitor];
+    if ( transform.layoutWidth == layoutWidth && transform.layoutHeight == layoutHeight )
+        return transform;
+
+    if ( composite_[monitor] ) {
+        transform              = MonitorTransform( );
+        transform.layoutWidth  = layoutWidth;
+        transform.layoutHeight = layoutHeight;
+    }
+    else {
+        transform = windowTransform( monitor, layoutWidth, layoutHeight );
+    }
+
+    return transform;
+}
+
+
+// Scale a clipped layout rectangle to the window and draw it, applying rotation and mirroring
+void SDL::renderTransformed( SDL_Texture *texture, Uint8 alpha, SDL_Rect const &srcRect, SDL_Rect dstRect, double angle, SDL_RendererFlip flip, int monitor, MonitorTransform const &transform )
+{
+    if ( srcRect.h <= 0 || srcRect.w <= 0 )
+        return;
+
+    SDL_Renderer *renderer = renderer_[monitor];
+    int           rotation = transform.rotation;
+
+    if ( !transform.mirror )
+        angle += rotation * 90;
+
+    dstRect.x = (int)(dstRect.x*transform.scaleX);
+    dstRect.y = (int)(dstRect.y*transform.scaleY);
+    dstRect.w = (int)(dstRect.w*transform.scaleX);
+    dstRect.h = (int)(dstRect.h*transform.scaleY);
+
+    SDL_SetTextureAlphaMod( texture, alpha );
+
+    if ( transform.mirror ) {
+        if ( rotation % 2 == 0 ) {
+            dstRect.y += windowHeight_[monitor] / 2;
+        }
+        else {
+            int tmp   = dstRect.x;
+            dstRect.x = windowWidth_[monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
+            dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
+            angle    += 90;
+        }
+        SDL_RenderCopyEx( renderer, texture, &srcRect, &dstRect, angle, nullptr, flip );
+        dstRect.x = windowWidth_[monitor] - dstRect.x - dstRect.w;
+        dstRect.y = windowHeight_[monitor] - dstRect.y - dstRect.h;
+        angle    += 180;
+        SDL_RenderCopyEx( renderer, texture, &srcRect, &dstRect, angle, nullptr, flip );
+        return;
+    }
+
+    // 90 degree rotation
+    if ( rotation == 1 ) {
+        int tmp   = dstRect.x;
+        dstRect.x = windowWidth_[monitor] - dstRect.y - dstRect.h/2 - dstRect.w/2;
+        dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
+    }
+    // 180 degree rotation
+    if ( rotation == 2 ) {
+        dstRect.x = windowWidth_[monitor] - dstRect.x - dstRect.w;
+        dstRect.y = windowHeight_[monitor] - dstRect.y - dstRect.h;
+    }
+    // 270 degree rotation
+    if ( rotation == 3 ) {
+        int tmp   = dstRect.x;
+        dstRect.x = dstRect.y + dstRect.h/2 - dstRect.w/2;
+        dstRect.y = windowHeight_[monitor] - tmp - dstRect.h/2 - dstRect.w/2;
+    }
+
+    SDL_RenderCopyEx( renderer, texture, &srcRect, &dstRect, angle, nullptr, flip );
+}
+
+
 // Render a copy of a texture
 bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SDL_Rect const *dest, ViewInfo &viewInfo, int layoutWidth, int layoutHeight )
 {
@@ -432,22 +724,32 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
     // Skip rendering if the object is invisible anyway or if renderer does not exist
     if ( alpha == 0 || viewInfo.Monitor >= screenCount_ || !renderer_[viewInfo.Monitor] )
         return true;
-    SDL_GetWindowSize( getWindow( viewInfo.Monitor ), &windowWidth_[viewInfo.Monitor], &windowHeight_[viewInfo.Monitor] );
 
-    float scaleX = (float)windowWidth_[viewInfo.Monitor]  / (float)layoutWidth;
-    float scaleY = (float)windowHeight_[viewInfo.Monitor] / (float)layoutHeight;
-
-    // 90 or 270 degree rotation; change scale factors
-    if ( rotation_[viewInfo.Monitor] % 2 == 1 ) {
-        scaleX = (float)windowHeight_[viewInfo.Monitor] / (float)layoutWidth;
-        scaleY = (float)windowWidth_[viewInfo.Monitor]  / (float)layoutHeight;
+    static const MonitorTransform layoutTransform;
+    bool capturing = capture_[viewInfo.Monitor];
+
+    if ( !capturing && composite_[viewInfo.Monitor] && !compositeActive_[viewInfo.Monitor] )
+        beginComposite( viewInfo.Monitor, layoutWidth, layoutHeight );
+
+    MonitorTransform const &transform = capturing ? layoutTransform : getTransform( viewInfo.Monitor, layoutWidth, layoutHeight );
+
+    // Plain scaled copy: no rotation, mirroring, reflection or container clipping
+    if ( transform.identity && viewInfo.Reflection.empty( ) &&
+         (viewInfo.ContainerWidth <= 0 || viewInfo.ContainerHeight <= 0) ) {
+        if ( !texture || (src && (src->w <= 0 || src->h <= 0)) )
+            return true;
+        SDL_Rect dstRect;
+        dstRect.x = (int)((dest->x + transform.offsetX)*transform.scaleX);
+        dstRect.y = (int)((dest->y + transform.offsetY)*transform.scaleY);
+        dstRect.w = (int)(dest->w*transform.scaleX);
+        dstRect.h = (int)(dest->h*transform.scaleY);
+        SDL_SetTextureAlphaMod( texture, static_cast<Uint8>( alpha * 255 ) );
+        SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, src, &dstRect, viewInfo.Angle, nullptr, SDL_FLIP_NONE );
+        return true;
     }
 
-    if ( mirror_[viewInfo.Monitor] )
-        scaleY /= 2;
-
     // Don't print outside the screen in mirror mode
-    if ( mirror_[viewInfo.Monitor] && (viewInfo.ContainerWidth < 0 || viewInfo.ContainerHeight < 0) ) {
+    if ( transform.mirror && (viewInfo.ContainerWidth < 0 || viewInfo.ContainerHeight < 0) ) {
         viewInfo.ContainerX      = 0;
         viewInfo.ContainerY      = 0;
         viewInfo.ContainerWidth  = static_cast<float>( layoutWidth );
@@ -463,18 +765,11 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
     double   imageScaleX;
     double   imageScaleY;
 
+    dstRect.x = dest->x + transform.offsetX;
+    dstRect.y = dest->y + transform.offsetY;
     dstRect.w = dest->w;
     dstRect.h = dest->h;
 
-    if ( fullscreen_[viewInfo.Monitor] ) {
-        dstRect.x = dest->x + (displayWidth_[viewInfo.Monitor] - windowWidth_[viewInfo.Monitor])/2;
-        dstRect.y = dest->y + (displayHeight_[viewInfo.Monitor] - windowHeight_[viewInfo.Monitor])/2;
-    }
-    else {
-        dstRect.x = dest->x;
-        dstRect.y = dest->y;
-    }
-
     // Create the base fields to check against the container.
     if (src) {
         srcRect.x = src->x;
@@ -549,66 +844,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
 
     }
 
-    double angle = viewInfo.Angle;
-    if ( !mirror_[viewInfo.Monitor] )
-        angle += rotation_[viewInfo.Monitor] * 90;
-
-    dstRect.x = (int)(dstRect.x*scaleX);
-    dstRect.y = (int)(dstRect.y*scaleY);
-    dstRect.w = (int)(dstRect.w*scaleX);
-    dstRect.h = (int)(dstRect.h*scaleY);
-
-    if ( mirror_[viewInfo.Monitor] ) {
-        if ( rotation_[viewInfo.Monitor] % 2 == 0 ) {
-            if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_NONE );
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                angle    += 180;
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_NONE );
-            }
-        }
-        else {
-            if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-                angle    += 90;
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_NONE );
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                angle    += 180;
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_NONE );
-            }
-        }
-    }
-    else {
-        // 90 degree rotation
-        if ( rotation_[viewInfo.Monitor] == 1 ) {
-            int tmp   = dstRect.x;
-            dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.y - dstRect.h/2 - dstRect.w/2;
-            dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-        }
-        // 180 degree rotation
-        if ( rotation_[viewInfo.Monitor] == 2 ) {
-            dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-            dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-        }
-        // 270 degree rotation
-        if ( rotation_[viewInfo.Monitor] == 3 ) {
-            int tmp   = dstRect.x;
-            dstRect.x = dstRect.y + dstRect.h/2 - dstRect.w/2;
-            dstRect.y = windowHeight_[viewInfo.Monitor] - tmp - dstRect.h/2 - dstRect.w/2;
-        }
-    
-        if ( srcRect.h > 0 && srcRect.w > 0 ) {
-            SDL_SetTextureAlphaMod( texture, static_cast<char>( alpha * 255 ) );
-            SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_NONE );
-        }
-    }
+    renderTransformed( texture, static_cast<Uint8>( alpha * 255 ), srcRect, dstRect, viewInfo.Angle, SDL_FLIP_NONE, viewInfo.Monitor, transform );
 
     // Restore original parameters
     srcRect.x     = srcRectOrig.x;
@@ -669,65 +905,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
-
-        dstRect.x = (int)(dstRect.x*scaleX);
-        dstRect.y = (int)(dstRect.y*scaleY);
-        dstRect.w = (int)(dstRect.w*scaleX);
-        dstRect.h = (int)(dstRect.h*scaleY);
-
-        if ( mirror_[viewInfo.Monitor] ) {
-            if ( rotation_[viewInfo.Monitor] % 2 == 0 ) {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                }
-            }
-            else {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    int tmp   = dstRect.x;
-                    dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                    dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-                    angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                }
-            }
-        }
-        else {
-            // 90 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 1 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-            }
-            // 180 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 2 ) {
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-            }
-            // 270 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 3 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = dstRect.y + dstRect.h/2 - dstRect.w/2;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - tmp - dstRect.h/2 - dstRect.w/2;
-            }
-            if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-            }
-        }
+        renderTransformed( texture, static_cast<Uint8>( viewInfo.ReflectionAlpha * alpha * 255 ), srcRect, dstRect, viewInfo.Angle, SDL_FLIP_VERTICAL, viewInfo.Monitor, transform );
     }
 
     // Restore original parameters
@@ -784,65 +962,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
             srcRect.h = static_cast<int>( dstRect.h * imageScaleY );
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
-
-        dstRect.x = (int)(dstRect.x*scaleX);
-        dstRect.y = (int)(dstRect.y*scaleY);
-        dstRect.w = (int)(dstRect.w*scaleX);
-        dstRect.h = (int)(dstRect.h*scaleY);
-
-        if ( mirror_[viewInfo.Monitor] ) {
-            if ( rotation_[viewInfo.Monitor] % 2 == 0 ) {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                }
-            }
-            else {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    int tmp   = dstRect.x;
-                    dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                    dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-                    angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-                }
-            }
-        }
-        else {
-            // 90 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 1 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-            }
-            // 180 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 2 ) {
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-            }
-            // 270 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 3 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = dstRect.y + dstRect.h/2 - dstRect.w/2;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - tmp - dstRect.h/2 - dstRect.w/2;
-            }
-            if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_VERTICAL );
-            }
-        }
+        renderTransformed( texture, static_cast<Uint8>( viewInfo.ReflectionAlpha * alpha * 255 ), srcRect, dstRect, viewInfo.Angle, SDL_FLIP_VERTICAL, viewInfo.Monitor, transform );
     }
 
     // Restore original parameters
@@ -899,65 +1019,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
-
-        dstRect.x = (int)(dstRect.x*scaleX);
-        dstRect.y = (int)(dstRect.y*scaleY);
-        dstRect.w = (int)(dstRect.w*scaleX);
-        dstRect.h = (int)(dstRect.h*scaleY);
-
-        if ( mirror_[viewInfo.Monitor] ) {
-            if ( rotation_[viewInfo.Monitor] % 2 == 0 ) {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                }
-            }
-            else {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    int tmp   = dstRect.x;
-                    dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                    dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-                    angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                }
-            }
-        }
-        else {
-            // 90 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 1 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-            }
-            // 180 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 2 ) {
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-            }
-            // 270 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 3 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = dstRect.y + dstRect.h/2 - dstRect.w/2;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - tmp - dstRect.h/2 - dstRect.w/2;
-            }
-            if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-            }
-        }
+        renderTransformed( texture, static_cast<Uint8>( viewInfo.ReflectionAlpha * alpha * 255 ), srcRect, dstRect, viewInfo.Angle, SDL_FLIP_HORIZONTAL, viewInfo.Monitor, transform );
     }
 
     // Restore original parameters
@@ -1014,65 +1076,7 @@ bool SDL::renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SD
 
         }
 
-        angle = viewInfo.Angle;
-        if ( !mirror_[viewInfo.Monitor] )
-            angle += rotation_[viewInfo.Monitor] * 90;
-
-        dstRect.x = (int)(dstRect.x*scaleX);
-        dstRect.y = (int)(dstRect.y*scaleY);
-        dstRect.w = (int)(dstRect.w*scaleX);
-        dstRect.h = (int)(dstRect.h*scaleY);
-
-        if ( mirror_[viewInfo.Monitor] ) {
-            if ( rotation_[viewInfo.Monitor] % 2 == 0 ) {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    dstRect.y += windowHeight_[viewInfo.Monitor] / 2;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                }
-            }
-            else {
-                if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                    int tmp   = dstRect.x;
-                    dstRect.x = windowWidth_[viewInfo.Monitor]/2 - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                    dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-                    angle    += 90;
-                    SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                    dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                    dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-                    angle    += 180;
-                    SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-                }
-            }
-        }
-        else {
-            // 90 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 1 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.y - dstRect.h/2 - dstRect.w/2;
-                dstRect.y = tmp - dstRect.h/2 + dstRect.w/2;
-            }
-            // 180 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 2 ) {
-                dstRect.x = windowWidth_[viewInfo.Monitor] - dstRect.x - dstRect.w;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - dstRect.y - dstRect.h;
-            }
-            // 270 degree rotation
-            if ( rotation_[viewInfo.Monitor] == 3 ) {
-                int tmp   = dstRect.x;
-                dstRect.x = dstRect.y + dstRect.h/2 - dstRect.w/2;
-                dstRect.y = windowHeight_[viewInfo.Monitor] - tmp - dstRect.h/2 - dstRect.w/2;
-            }
-            if ( srcRect.h > 0 && srcRect.w > 0 ) {
-                SDL_SetTextureAlphaMod( texture, static_cast<char>( viewInfo.ReflectionAlpha * alpha * 255 ) );
-                SDL_RenderCopyEx( renderer_[viewInfo.Monitor], texture, &srcRect, &dstRect, angle, nullptr, SDL_FLIP_HORIZONTAL );
-            }
-        }
+        renderTransformed( texture, static_cast<Uint8>( viewInfo.ReflectionAlpha * alpha * 255 ), srcRect, dstRect, viewInfo.Angle, SDL_FLIP_HORIZONTAL, viewInfo.Monitor, transform );
     }
     return true;
 }
@@ -17,12 +17,15 @@
 
 
 #include <SDL2/SDL.h>
+#include <atomic>
 #include <string>
+#include <thread>
 #include "Graphics/ViewInfo.h"
 #include <vector>
 
 
 class Configuration;
+class Task;
 
 
 class SDL
@@ -32,9 +35,19 @@ public:
     static bool deInitialize( );
     static SDL_Renderer *getRenderer( int index );
     static std::string getRendererBackend(int index);
-    static SDL_mutex *getMutex( );
     static SDL_Window *getWindow( int index );
     static bool renderCopy( SDL_Texture *texture, float alpha, SDL_Rect const *src, SDL_Rect const *dest, ViewInfo &viewInfo, int layoutWidth, int layoutHeight );
+    static void beginFrame( );
+    static void endFrame( );
+
+    // Only the thread drawing frames touches the renderers. Other threads queue their
+    // texture work, which beginFrame runs before anything is drawn.
+    static bool isRenderThread( );
+    static void runOnRenderThread( Task &&command );
+    static void destroyTexture( SDL_Texture *texture );
+    static void runRenderCommands( );
+    static bool beginCapture( int monitor, SDL_Texture *texture );
+    static void endCapture( int monitor );
     static int getScreenCount( ) 
 	{
         return screenCount_;
@@ -62,6 +75,8 @@ public:
     static void setRotation(int index, int rotation)
     {
         rotation_[index] = rotation;
+        if ( index < static_cast<int>( transform_.size( ) ) )
+            transform_[index].layoutWidth = 0;
     }
     static int getRotation(int index)
     {
@@ -69,9 +84,31 @@ public:
     }
 
 private:
+    // Layout to window mapping of a monitor, cached until the window size,
+    // rotation or layout dimensions change.
+    struct MonitorTransform
+    {
+        int   layoutWidth{0};
+        int   layoutHeight{0};
+        float scaleX{1};
+        float scaleY{1};
+        int   offsetX{0};
+        int   offsetY{0};
+        int   rotation{0};
+        bool  mirror{false};
+        bool  identity{true};
+    };
+
+    static MonitorTransform windowTransform( int monitor, int layoutWidth, int layoutHeight );
+    static const MonitorTransform &getTransform( int monitor, int layoutWidth, int layoutHeight );
+    static void beginComposite( int monitor, int layoutWidth, int layoutHeight );
+    static void renderTransformed( SDL_Texture *texture, Uint8 alpha, SDL_Rect const &srcRect, SDL_Rect dstRect, double angle, SDL_RendererFlip flip, int monitor, MonitorTransform const &transform );
+
     static std::vector<SDL_Window *>   window_;
     static std::vector<SDL_Renderer *> renderer_;
-    static SDL_mutex                  *mutex_;
+    struct RenderCommand;
+    static std::atomic<RenderCommand *> renderCommands_;
+    static std::atomic<std::thread::id> renderThread_;
     static std::vector<int>            displayWidth_;
     static std::vector<int>            displayHeight_;
     static std::vector<int>            windowWidth_;
@@ -82,4 +119,9 @@ private:
     static int                         numScreens_;
     static int                         numDisplays_;
 	static int                         screenCount_;
+    static std::vector<MonitorTransform> transform_;
+    static std::vector<bool>           composite_;
+    static std::vector<SDL_Texture *>  compositeTexture_;
+    static std::vector<bool>           compositeActive_;
+    static std::vector<bool>           capture_;
 };
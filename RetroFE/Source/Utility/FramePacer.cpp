@@ -0,0 +1,164 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FramePacer.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+FramePacer::FramePacer()
+    : frequency_(SDL_GetPerformanceFrequency())
+    , start_(SDL_GetPerformanceCounter())
+    , last_(start_)
+    , deadline_(start_)
+    , period_(0)
+    , minSpinMargin_(frequency_ / 500)
+    , maxSpinMargin_(frequency_ / 250)
+    , spinMargin_(minSpinMargin_)
+    , buckets_()
+    , frames_(0)
+    , sum_(0)
+    , sumSquares_(0)
+    , min_(0)
+    , max_(0)
+{
+}
+
+void FramePacer::setPeriod(double seconds)
+{
+    period_ = (seconds > 0) ? static_cast<Uint64>(seconds * static_cast<double>(frequency_)) : 0;
+}
+
+double FramePacer::tick()
+{
+    wait();
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    double dt  = static_cast<double>(now - last_) / static_cast<double>(frequency_);
+    last_ = now;
+    if (period_ == 0)
+        deadline_ = now;
+
+    record(dt);
+    return dt;
+}
+
+void FramePacer::reset()
+{
+    last_     = SDL_GetPerformanceCounter();
+    deadline_ = last_;
+}
+
+double FramePacer::now() const
+{
+    return static_cast<double>(SDL_GetPerformanceCounter() - start_) / static_cast<double>(frequency_);
+}
+
+void FramePacer::wait()
+{
+    if (period_ == 0)
+        return;
+
+    deadline_ += period_;
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    // More than a frame behind (a stall, a game launch, an idle wait): restart the schedule
+    // from here instead of rushing through the missed frames
+    if (now >= deadline_ + period_) {
+        deadline_ = now;
+        return;
+    }
+
+    // Sleep while it is safe, then spin the last stretch
+    while (now + spinMargin_ < deadline_) {
+        Uint64 ms = (deadline_ - spinMargin_ - now) * 1000 / frequency_;
+        if (ms == 0)
+            break;
+        Uint64 before = now;
+        SDL_Delay(static_cast<Uint32>(ms));
+        now = SDL_GetPerformanceCounter();
+
+        // Widen the margin when the scheduler oversleeps and let it settle back by an
+        // eighth each time a sleep lands on time, so one hiccup does not spin for good
+        Uint64 expected = ms * frequency_ / 1000;
+        Uint64 slept    = now - before;
+        if (slept > expected + spinMargin_)
+            spinMargin_ = std::min(slept - expected, maxSpinMargin_);
+        else if (slept <= expected + minSpinMargin_)
+            spinMargin_ -= (spinMargin_ - minSpinMargin_) / 8;
+    }
+    while (now < deadline_)
+        now = SDL_GetPerformanceCounter();
+}
+
+void FramePacer::record(double seconds)
+{
+    double ms     = seconds * 1000;
+    int    bucket = std::min(static_cast<int>(ms / bucketWidth_), bucketCount_ - 1);
+    buckets_[bucket]++;
+
+    if (frames_ == 0 || ms < min_)
+        min_ = ms;
+    if (frames_ == 0 || ms > max_)
+        max_ = ms;
+    frames_++;
+    sum_        += ms;
+    sumSquares_ += ms * ms;
+}
+
+std::string FramePacer::histogram() const
+{
+    std::stringstream ss;
+    if (frames_ == 0)
+        return "no frames";
+
+    double mean   = sum_ / static_cast<double>(frames_);
+    double stddev = std::sqrt(std::max(0.0, sumSquares_ / static_cast<double>(frames_) - mean * mean));
+
+    // Percentiles are reported as the upper edge of the bucket they fall in
+    Uint64 rank50 = (frames_ + 1) / 2;
+    Uint64 rank99 = std::max<Uint64>(1, frames_ * 99 / 100);
+    double p50 = 0;
+    double p99 = 0;
+    Uint64 seen = 0;
+    Uint64 tallest = 0;
+    for (int i = 0; i < bucketCount_; i++) {
+        if (seen < rank50 && seen + buckets_[i] >= rank50)
+            p50 = (i + 1) * bucketWidth_;
+        if (seen < rank99 && seen + buckets_[i] >= rank99)
+            p99 = (i + 1) * bucketWidth_;
+        seen += buckets_[i];
+        tallest = std::max(tallest, buckets_[i]);
+    }
+
+    ss << std::fixed << std::setprecision(3);
+    ss << frames_ << " frames, mean " << mean << "ms, stddev " << stddev << "ms, min " << min_
+       << "ms, max " << max_ << "ms, p50 <" << p50 << "ms, p99 <" << p99 << "ms";
+
+    ss << std::setprecision(2);
+    for (int i = 0; i < bucketCount_; i++) {
+        if (buckets_[i] == 0)
+            continue;
+        ss << std::endl << std::setw(7) << i * bucketWidth_;
+        if (i == bucketCount_ - 1)
+            ss << "ms+       ";
+        else
+            ss << "-" << std::setw(6) << std::left << (i + 1) * bucketWidth_ << std::right << "ms ";
+        ss << std::setw(8) << buckets_[i] << " " << std::string(static_cast<size_t>(buckets_[i] * 40 / tallest), '#');
+    }
+    return ss.str();
+}
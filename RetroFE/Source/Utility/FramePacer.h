@@ -0,0 +1,66 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <string>
+
+// Paces a render loop on the performance counter. Each frame waits for an absolute
+// deadline (previous deadline + period) by sleeping until shortly before it and spinning
+// the rest, so SDL_Delay granularity does not turn into frame jitter or drift.
+class FramePacer
+{
+public:
+    FramePacer();
+
+    // Seconds per frame; 0 disables waiting (e.g. when present already blocks on vsync)
+    void   setPeriod(double seconds);
+
+    // Waits for the next deadline and returns the seconds elapsed since the previous frame
+    double tick();
+
+    // Starts timing afresh so the next tick() does not report time spent away from the loop
+    void   reset();
+
+    // Seconds since the pacer was created
+    double now() const;
+
+    // Frame time statistics and histogram of the intervals returned by tick()
+    std::string histogram() const;
+
+private:
+    static constexpr double bucketWidth_ = 0.25; // milliseconds
+    static constexpr int    bucketCount_ = 200;  // last bucket collects everything above 50ms
+
+    void wait();
+    void record(double seconds);
+
+    Uint64 frequency_;
+    Uint64 start_;
+    Uint64 last_;
+    Uint64 deadline_;
+    Uint64 period_;
+    Uint64 minSpinMargin_; // 2ms, where the margin settles while sleeps land on time
+    Uint64 maxSpinMargin_; // 4ms, the most a frame will spin after the scheduler oversleeps
+    Uint64 spinMargin_;
+
+    Uint64 buckets_[bucketCount_];
+    Uint64 frames_;
+    double sum_;
+    double sumSquares_;
+    double min_;
+    double max_;
+};
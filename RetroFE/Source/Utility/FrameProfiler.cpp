@@ -0,0 +1,151 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "FrameProfiler.h"
+#include <algorithm>
+#include <fstream>
+
+static const char *phaseNames[FrameProfiler::PhaseCount] = {
+    "input",
+    "update",
+    "updateWait",
+    "video",
+    "commands",
+    "draw",
+    "present",
+    "pacing",
+    "frame"
+};
+
+std::atomic<bool> FrameProfiler::enabled_(false);
+std::atomic<Uint64> FrameProfiler::current_[FrameProfiler::PhaseCount];
+Uint64 FrameProfiler::frameStart_ = 0;
+std::mutex FrameProfiler::ringMutex_;
+float FrameProfiler::ring_[FrameProfiler::frames_][FrameProfiler::PhaseCount];
+size_t FrameProfiler::next_ = 0;
+size_t FrameProfiler::recorded_ = 0;
+
+FrameProfiler::Scope::Scope(Phase phase)
+    : phase_(phase)
+    , start_(enabled_.load(std::memory_order_relaxed) ? SDL_GetPerformanceCounter() : 0)
+{
+}
+
+FrameProfiler::Scope::~Scope()
+{
+    if (start_ != 0) {
+        add(phase_, SDL_GetPerformanceCounter() - start_);
+    }
+}
+
+void FrameProfiler::setEnabled(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    if (enabled && !enabled_) {
+        for (auto &phase : current_) {
+            phase = 0;
+        }
+        frameStart_ = SDL_GetPerformanceCounter();
+        next_       = 0;
+        recorded_   = 0;
+    }
+    enabled_ = enabled;
+}
+
+bool FrameProfiler::isEnabled()
+{
+    return enabled_.load(std::memory_order_relaxed);
+}
+
+void FrameProfiler::add(Phase phase, Uint64 ticks)
+{
+    current_[phase].fetch_add(ticks, std::memory_order_relaxed);
+}
+
+void FrameProfiler::endFrame()
+{
+    if (!enabled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    float  msPerTick = 1000.0f / static_cast<float>(SDL_GetPerformanceFrequency());
+
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    current_[PhaseFrame] = now - frameStart_;
+    frameStart_ = now;
+    for (int i = 0; i < PhaseCount; i++) {
+        ring_[next_][i] = static_cast<float>(current_[i].exchange(0, std::memory_order_relaxed)) * msPerTick;
+    }
+    next_ = (next_ + 1) % frames_;
+    recorded_ = std::min(recorded_ + 1, frames_);
+}
+
+size_t FrameProfiler::summary(std::vector<Stats> &stats)
+{
+    std::vector<float> samples;
+
+    stats.clear();
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    if (recorded_ == 0) {
+        return 0;
+    }
+
+    samples.reserve(recorded_);
+    for (int i = 0; i < PhaseCount; i++) {
+        samples.clear();
+        float sum = 0;
+        for (size_t f = 0; f < recorded_; f++) {
+            samples.push_back(ring_[f][i]);
+            sum += ring_[f][i];
+        }
+        size_t p99 = (recorded_ - 1) * 99 / 100;
+        std::nth_element(samples.begin(), samples.begin() + p99, samples.end());
+
+        Stats phase;
+        phase.name = phaseNames[i];
+        phase.min  = *std::min_element(samples.begin(), samples.end());
+        phase.avg  = sum / static_cast<float>(recorded_);
+        phase.p99  = samples[p99];
+        stats.push_back(phase);
+    }
+    return recorded_;
+}
+
+bool FrameProfiler::writeCsv(const std::string &file)
+{
+    std::ofstream csv(file.c_str());
+    if (!csv.is_open()) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(ringMutex_);
+    for (int i = 0; i < PhaseCount; i++) {
+        csv << (i ? "," : "") << phaseNames[i];
+    }
+    csv << "\n";
+
+    // Oldest frame first
+    size_t first = (recorded_ < frames_) ? 0 : next_;
+    for (size_t f = 0; f < recorded_; f++) {
+        const float *frame = ring_[(first + f) % frames_];
+        for (int i = 0; i < PhaseCount; i++) {
+            csv << (i ? "," : "") << frame[i];
+        }
+        csv << "\n";
+    }
+    return csv.good();
+}
@@ -0,0 +1,86 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Collects how long each phase of a frame takes into a ring of recent frames.
+// Phases are timed with FrameProfiler::Scope; times from worker threads are summed
+// into the frame that is open when they finish. Costs one atomic load per scope
+// while disabled.
+class FrameProfiler
+{
+public:
+    enum Phase
+    {
+        PhaseInput,
+        PhaseUpdate,
+        PhaseUpdateWait,
+        PhaseVideo,
+        PhaseCommands,
+        PhaseDraw,
+        PhasePresent,
+        PhasePacing,
+        PhaseFrame,
+        // leave PhaseCount at the end
+        PhaseCount
+    };
+
+    struct Stats
+    {
+        const char *name;
+        float min;
+        float avg;
+        float p99;
+    };
+
+    class Scope
+    {
+    public:
+        explicit Scope(Phase phase);
+        ~Scope();
+    private:
+        Phase  phase_;
+        Uint64 start_;
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+    static void add(Phase phase, Uint64 ticks);
+
+    // Records the phases added since the previous call as one frame, together with the
+    // time since the previous call as its length
+    static void endFrame();
+
+    // Min/avg/p99 per phase in milliseconds over the recorded frames; returns the frame count
+    static size_t summary(std::vector<Stats> &stats);
+    static bool writeCsv(const std::string &file);
+
+private:
+    static const size_t frames_ = 600;
+
+    static std::atomic<bool> enabled_;
+    static std::atomic<Uint64> current_[PhaseCount];
+    static Uint64 frameStart_;
+    static std::mutex ringMutex_;
+    static float ring_[frames_][PhaseCount];
+    static size_t next_;
+    static size_t recorded_;
+};
@@ -0,0 +1,49 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Interner.h"
+
+int Interner::intern(std::string_view name)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    int id = static_cast<int>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+int Interner::find(std::string_view name) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = ids_.find(name);
+    return it != ids_.end() ? it->second : -1;
+}
+
+std::string Interner::name(int id) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (id >= 0 && static_cast<size_t>(id) < names_.size()) ? names_[id] : "";
+}
+
+size_t Interner::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return names_.size();
+}
@@ -0,0 +1,42 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Maps names to small, dense integer ids (0, 1, 2, ...) so per-frame code can compare
+// and index by int instead of by string. Ids are never reused or removed.
+class Interner
+{
+public:
+    // Returns the id of name, adding it when it is new
+    int intern(std::string_view name);
+
+    // Returns the id of name, or -1 when it was never interned
+    int find(std::string_view name) const;
+
+    std::string name(int id) const;
+    size_t size() const;
+
+private:
+    mutable std::mutex mutex_;
+    std::map<std::string, int, std::less<>> ids_;
+    std::vector<std::string> names_;
+};
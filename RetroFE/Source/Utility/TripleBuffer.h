@@ -0,0 +1,81 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+// Hands values from one producer thread to one consumer thread without locking. The
+// producer writes into its own slot and swaps it with the shared middle one, the
+// consumer swaps the middle one with its own slot, so neither ever waits on the other
+// and the consumer always gets the newest value. T must be cheap to move and T{} is
+// treated as empty, e.g. a pointer the caller holds a reference on.
+template<class T>
+class TripleBuffer
+{
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Producer side. Returns the value this one replaces when the consumer never took
+    // it, or T{}, so the caller can release it.
+    T publish(T value)
+    {
+        slots_[back_] = std::move(value);
+        uint8_t previous = middle_.exchange(static_cast<uint8_t>(back_ | fresh), std::memory_order_acq_rel);
+        back_ = previous & indexMask;
+        return std::exchange(slots_[back_], T{});
+    }
+
+    // Consumer side. Moves the newest value into out, false when nothing new arrived.
+    bool take(T& out)
+    {
+        if (!hasNew()) {
+            return false;
+        }
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & indexMask;
+        out = std::exchange(slots_[front_], T{});
+        return true;
+    }
+
+    bool hasNew() const
+    {
+        return (middle_.load(std::memory_order_acquire) & fresh) != 0;
+    }
+
+    // Hands every value still held to release. Only safe while neither side is running.
+    template<class F>
+    void clear(F&& release)
+    {
+        for (T& slot : slots_) {
+            if (slot != T{}) {
+                release(std::exchange(slot, T{}));
+            }
+        }
+        middle_.store(static_cast<uint8_t>(middle_.load(std::memory_order_relaxed) & indexMask), std::memory_order_release);
+    }
+
+private:
+    static constexpr uint8_t indexMask = 0x3;
+    static constexpr uint8_t fresh     = 0x4;
+
+    T slots_[3]{};
+    uint8_t back_{ 0 };
+    uint8_t front_{ 2 };
+    std::atomic<uint8_t> middle_{ 1 };
+};
@@ -47,6 +47,7 @@ std::unordered_set<std::filesystem::path, PathHash> Utils::nonExistingDirectorie
 std::unordered_map<std::filesystem::path, std::unordered_set<std::string>> Utils::fileCache;
 std::unordered_set<std::filesystem::path> Utils::nonExistingDirectories;
 #endif
+std::mutex Utils::cacheMutex;
 
 Utils::Utils() = default;
 
@@ -145,6 +146,7 @@ bool Utils::findMatchingFile(const std::string& prefix, const std::vector<std::s
 
         fs::path absolutePath = Utils::combinePath(Configuration::absolutePath, prefix);
         fs::path baseDir = absolutePath.parent_path();
+        std::lock_guard<std::mutex> lock(cacheMutex);
 
         // Check if the directory is known to not exist
         if (nonExistingDirectories.find(baseDir) != nonExistingDirectories.end()) {
@@ -19,6 +19,7 @@
 #include <vector>
 #include <list>
 #include <filesystem>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -88,6 +89,8 @@ private:
     static std::unordered_map<std::filesystem::path, std::unordered_set<std::string>> fileCache;
     static std::unordered_set<std::filesystem::path> nonExistingDirectories;
 #endif
+    // Guards both caches, lookups come from the update threads and the preroll tasks
+    static std::mutex cacheMutex;
     static void populateCache(const std::filesystem::path& directory);
     static bool isFileInCache(const std::filesystem::path& directory, const std::string& filename);
     static bool isFileCachePopulated(const std::filesystem::path& directory);
@@ -14,16 +14,24 @@
  * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "GStreamerVideo.h"
+#include "PosterCache.h"
+#include "../Graphics/ThreadPool.h"
 #include "../Graphics/ViewInfo.h"
 #include "../Graphics/Component/Image.h"
 #include "../Database/Configuration.h"
+#include "../Execute/Benchmark.h"
+#include "../Utility/FrameProfiler.h"
 #include "../Utility/Log.h"
 #include "../Utility/Utils.h"
 #include "../SDL.h"
+#include <algorithm>
 #include <sstream>
 #include <cstring>
 #include <cstdlib>
 #include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <utility>
 #include <vector>
 #include <SDL2/SDL.h>
 #include <sys/stat.h>
@@ -35,6 +43,17 @@
 #include <gst/audio/audio.h>
 
 bool GStreamerVideo::initialized_ = false;
+std::mutex GStreamerVideo::poolMutex_;
+std::vector<GStreamerVideo::Pipeline> GStreamerVideo::pool_;
+size_t GStreamerVideo::poolSize_ = 4;
+std::vector<GStreamerVideo::Prerolled> GStreamerVideo::prerolled_;
+size_t GStreamerVideo::prerollCount_ = 2;
+std::map<const void*, unsigned int> GStreamerVideo::prerollTickets_;
+unsigned int GStreamerVideo::prerollTicket_ = 0;
+TaskGroup GStreamerVideo::prerolls_;
+std::atomic<int> GStreamerVideo::decodeThreads_(0);
+std::atomic<unsigned int> GStreamerVideo::pipelinesCreated_(0);
+std::atomic<unsigned int> GStreamerVideo::pipelinesReused_(0);
 
 GStreamerVideo::GStreamerVideo( int monitor )
 
@@ -57,7 +76,18 @@ void GStreamerVideo::setNumLoops(int n)
 
 SDL_Texture *GStreamerVideo::getTexture() const
 {
-    return texture_;
+    return getTexture(monitor_);
+}
+
+
+SDL_Texture *GStreamerVideo::getTexture(int monitor) const
+{
+    for (const Output& output : outputs_) {
+        if (output.monitor == monitor) {
+            return output.texture;
+        }
+    }
+    return nullptr;
 }
 
 
@@ -100,9 +130,10 @@ bool GStreamerVideo::stop()
         return false;
     }
 
-    // Disable handoffs for videoSink
-    if (videoSink_) {
-        g_object_set(G_OBJECT(videoSink_), "signal-handoffs", FALSE, nullptr);
+    // Only a pipeline that finished initializing is worth keeping
+    bool complete = elementSetupHandlerId_ != 0;
+    if (complete) {
+        logFrameCounts();
     }
 
     // Disconnect associated signals
@@ -111,19 +142,23 @@ bool GStreamerVideo::stop()
         elementSetupHandlerId_ = 0;
     }
 
-    if (videoSink_ && handoffHandlerId_) {
-        g_signal_handler_disconnect(videoSink_, handoffHandlerId_);
-        handoffHandlerId_ = 0;
+    // Messages posted from here on queue up and go with the pipeline or the pool's flush
+    if (videoBus_) {
+        gst_bus_set_sync_handler(videoBus_, nullptr, nullptr, nullptr);
     }
+    looping_.reset();
+
+    // Keep the pipeline for the next video when the pool has room
+    bool pooled = complete && playbin_ && poolPipeline();
 
     // Release the custom video sink bin
-    if (videoBin_) {
+    if (videoBin_ && !pooled) {
         gst_object_unref(videoBin_);
         videoBin_ = nullptr;
     }
 
     // Initiate the transition of playbin to GST_STATE_NULL without waiting
-    if (playbin_) {
+    if (playbin_ && !pooled) {
         gst_element_set_state(playbin_, GST_STATE_NULL);
 
         // Optionally perform a quick, non-blocking state check
@@ -133,31 +168,41 @@ bool GStreamerVideo::stop()
         }
     }
 
-    // Release SDL Texture
-    if (texture_) {
-        SDL_DestroyTexture(texture_);
-        texture_ = nullptr;
+    // Release SDL Textures
+    for (const Output& output : outputs_) {
+        SDL::destroyTexture(output.texture);
     }
-
-    // Unref the video buffer
-    if (videoBuffer_) {
-        gst_clear_buffer(&videoBuffer_);
+    outputs_.clear();
+    releasedOutputs_ = 0;
+    if (frame_) {
+        gst_sample_unref(frame_);
+        frame_ = nullptr;
     }
 
+    // Release the samples draw() never got to
+    frames_.clear([](GstSample* sample) { gst_sample_unref(sample); });
+    framesPulled_ = 0;
+    framesShown_ = 0;
+    framesReplaced_ = 0;
+    bytesUploaded_ = 0;
+    targetWidth_ = 0;
+    targetHeight_ = 0;
+    gst_caps_replace(&frameCaps_, nullptr);
+    frameWidth_ = 0;
+    frameHeight_ = 0;
+
     // Free GStreamer elements and related resources
-    if (playbin_) {
+    if (playbin_ && !pooled) {
         gst_object_unref(GST_OBJECT(playbin_));
-        playbin_ = nullptr;
     }
+    playbin_ = nullptr;
 
     // Reset remaining pointers and variables to ensure the object is in a clean state.
     videoMeta_ = nullptr;
     videoBus_ = nullptr;
     playbin_ = nullptr;
     videoBin_ = nullptr;
-    capsFilter_ = nullptr;
     videoSink_ = nullptr;
-    videoBuffer_ = nullptr;
     
     expectedBufSize_ = 0;
     isPlaying_ = false;
@@ -170,8 +215,6 @@ bool GStreamerVideo::stop()
 
 bool GStreamerVideo::play(const std::string& file)
 {
-    playCount_ = 0;
-
     if(!initialized_)
         return false;
 
@@ -202,12 +245,20 @@ bool GStreamerVideo::play(const std::string& file)
 
 
     currentFile_ = file;
+    playStart_ = SDL_GetPerformanceCounter();
+    lastPull_ = 0;
+    lastPts_ = GST_CLOCK_TIME_NONE;
 
-    if(!initializeGstElements(file))
+    // A prerolled pipeline already has its first frame and only needs to start
+    if(!adoptPrerolled(file) && !initializeGstElements(file))
         return false;
 
+    looping_->numLoops = numLoops_;
+    looping_->playCount = 0;
+    looping_->finished = false;
+
     // Start playing
-    if (GstStateChangeReturn playState = gst_element_set_state(GST_ELEMENT(playbin_), GST_STATE_PLAYING); playState != GST_STATE_CHANGE_ASYNC) {
+    if (GstStateChangeReturn playState = gst_element_set_state(GST_ELEMENT(playbin_), GST_STATE_PLAYING); playState == GST_STATE_CHANGE_FAILURE) {
         isPlaying_ = false;
         LOG_ERROR("Video", "Unable to set the pipeline to the playing state.");
         stop();
@@ -252,52 +303,360 @@ bool GStreamerVideo::initializeGstElements(const std::string& file)
     if(!uriFile)
         return false;
 
-    playbin_ = gst_element_factory_make("playbin3", "player");
-    videoBin_ = gst_bin_new("SinkBin");
-    videoSink_ = gst_element_factory_make("fakesink", "video_sink");
-    capsFilter_ = gst_element_factory_make("capsfilter", "caps_filter");
-    GstCaps* videoConvertCaps;
-    if (useD3dHardware_ || useVaHardware_) {
-        videoConvertCaps = gst_caps_from_string("video/x-raw,format=(string)NV12,pixel-aspect-ratio=(fraction)1/1");
+    // Reuse a pipeline parked in READY, it only needs the new URI
+    bool hardware = useD3dHardware_ || useVaHardware_;
+    reusedPipeline_ = false;
+    prerolledPipeline_ = false;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        for (auto it = pool_.begin(); it != pool_.end(); ++it) {
+            if (it->hardware == hardware) {
+                playbin_ = it->playbin;
+                videoBin_ = it->videoBin;
+                videoSink_ = it->videoSink;
+                pool_.erase(it);
+                reusedPipeline_ = true;
+                break;
+            }
+        }
+    }
+
+    if (reusedPipeline_) {
+        pipelinesReused_++;
+    }
+    else if (createPipeline()) {
+        pipelinesCreated_++;
     }
     else {
-        videoConvertCaps = gst_caps_from_string("video/x-raw,format=(string)I420,pixel-aspect-ratio=(fraction)1/1");
+        g_free(uriFile);
+        return false;
     }
 
-    if (!playbin_ || !videoSink_ || !capsFilter_) {
+    g_object_set(G_OBJECT(playbin_), "uri", uriFile, nullptr);
+    g_free(uriFile);
+    elementSetupHandlerId_ = g_signal_connect(playbin_, "element-setup", G_CALLBACK(elementSetupCallback), this);
+    videoBus_ = gst_pipeline_get_bus(GST_PIPELINE(playbin_));
+    gst_object_unref(videoBus_);
+
+    // Loop as the bus posts the end of the file, rather than polling it every frame
+    looping_ = std::make_shared<Looping>();
+    gst_bus_set_sync_handler(videoBus_, busSyncHandler, new std::shared_ptr<Looping>(looping_),
+        [](gpointer data) { delete static_cast<std::shared_ptr<Looping>*>(data); });
+
+    return true;
+}
+
+GstCaps* GStreamerVideo::sinkCaps(int maxWidth, int maxHeight) const
+{
+    std::string caps = (useD3dHardware_ || useVaHardware_)
+        ? "video/x-raw,format=(string)NV12,pixel-aspect-ratio=(fraction)1/1"
+        : "video/x-raw,format=(string)I420,pixel-aspect-ratio=(fraction)1/1";
+
+    // Ranges rather than a fixed size, so smaller videos are never scaled up and the
+    // scaler keeps the aspect ratio
+    if (maxWidth > 0 && maxHeight > 0) {
+        caps += ",width=(int)[1," + std::to_string(maxWidth) + "],height=(int)[1," + std::to_string(maxHeight) + "]";
+    }
+    return gst_caps_from_string(caps.c_str());
+}
+
+bool GStreamerVideo::createPipeline()
+{
+    playbin_ = gst_element_factory_make("playbin3", "player");
+    videoBin_ = gst_bin_new("SinkBin");
+    videoSink_ = gst_element_factory_make("appsink", "video_sink");
+    GstCaps* videoConvertCaps = sinkCaps(0, 0);
+
+    if (!playbin_ || !videoSink_) {
+        gst_caps_unref(videoConvertCaps);
         LOG_DEBUG("Video", "Could not create elements");
         return false;
     }
 
-    g_object_set(G_OBJECT(capsFilter_), "caps", videoConvertCaps, nullptr);
+    // Hold only the newest frame: when rendering falls behind the older one is dropped
+    // instead of stalling the decoder, and frames later than max-lateness are skipped
+    gst_app_sink_set_caps(GST_APP_SINK(videoSink_), videoConvertCaps);
     gst_caps_unref(videoConvertCaps);
     videoConvertCaps = nullptr;
+    gst_app_sink_set_max_buffers(GST_APP_SINK(videoSink_), 1);
+    gst_app_sink_set_drop(GST_APP_SINK(videoSink_), TRUE);
+    gst_app_sink_set_emit_signals(GST_APP_SINK(videoSink_), FALSE);
+    g_object_set(G_OBJECT(videoSink_), "sync", TRUE, "qos", TRUE, "max-lateness", static_cast<gint64>(20 * GST_MSECOND), "enable-last-sample", FALSE, nullptr);
 
-    gst_bin_add_many(GST_BIN(videoBin_), capsFilter_, videoSink_, nullptr);
-
-    // Directly link capsFilter to videoSink
-    if (!gst_element_link(capsFilter_, videoSink_)) {
-        LOG_DEBUG("Video", "Could not link video processing elements");
-        return false;
-    }
+    gst_bin_add(GST_BIN(videoBin_), videoSink_);
 
     GstPad* sinkPad = nullptr;
-    sinkPad = gst_element_get_static_pad(capsFilter_, "sink");
+    sinkPad = gst_element_get_static_pad(videoSink_, "sink");
 
     GstPad* ghostPad = gst_ghost_pad_new("sink", sinkPad);
     gst_element_add_pad(videoBin_, ghostPad);
     gst_object_unref(sinkPad);
 
-    // Set properties of playbin and videoSink
+    // Set properties of playbin
     const guint PLAYBIN_FLAGS = 0x00000001 | 0x00000002;
-    g_object_set(G_OBJECT(playbin_), "uri", uriFile, "video-sink", videoBin_, "instant-uri", TRUE, "flags", PLAYBIN_FLAGS, "buffer-size", -1, nullptr);
-    g_free(uriFile);
-    elementSetupHandlerId_ = g_signal_connect(playbin_, "element-setup", G_CALLBACK(elementSetupCallback), this);
-    videoBus_ = gst_pipeline_get_bus(GST_PIPELINE(playbin_));
-    gst_object_unref(videoBus_);
-    g_object_set(G_OBJECT(videoSink_), "signal-handoffs", TRUE, "sync", TRUE, "enable-last-sample", FALSE, nullptr);
-    handoffHandlerId_ = g_signal_connect(videoSink_, "handoff", G_CALLBACK(processNewBuffer), this);
+    g_object_set(G_OBJECT(playbin_), "video-sink", videoBin_, "instant-uri", TRUE, "flags", PLAYBIN_FLAGS, "buffer-size", -1, nullptr);
+
+    return true;
+}
+
+bool GStreamerVideo::poolPipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        if (pool_.size() >= poolSize_) {
+            return false;
+        }
+    }
+
+    // READY joins the streaming threads but keeps the elements, and the decoders playbin3
+    // already plugged can take the next file
+    if (gst_element_set_state(playbin_, GST_STATE_READY) == GST_STATE_CHANGE_FAILURE) {
+        return false;
+    }
+
+    // The next video starts at its native size again
+    if (targetWidth_) {
+        GstCaps* caps = sinkCaps(0, 0);
+        gst_app_sink_set_caps(GST_APP_SINK(videoSink_), caps);
+        gst_caps_unref(caps);
+    }
+
+    // Drop messages such as an EOS meant for this video
+    GstBus* bus = gst_pipeline_get_bus(GST_PIPELINE(playbin_));
+    gst_bus_set_flushing(bus, TRUE);
+    gst_bus_set_flushing(bus, FALSE);
+    gst_object_unref(bus);
+
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    if (pool_.size() >= poolSize_) {
+        return false;
+    }
+    pool_.push_back({ playbin_, videoBin_, videoSink_, useD3dHardware_ || useVaHardware_ });
+    return true;
+}
+
+void GStreamerVideo::setPoolSize(int size)
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    poolSize_ = static_cast<size_t>(std::max(0, size));
+}
+
+void GStreamerVideo::clearPool()
+{
+    // Stopping a prerolled video parks its pipeline in the pool, so these go first
+    std::vector<Prerolled> prerolled;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        prerollTickets_.clear();
+    }
+    prerolls_.wait();
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        prerolled.swap(prerolled_);
+    }
+    for (Prerolled const& entry : prerolled) {
+        delete entry.video;
+    }
+
+    std::vector<Pipeline> pipelines;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        pipelines.swap(pool_);
+    }
+
+    for (Pipeline const& pipeline : pipelines) {
+        gst_object_unref(pipeline.videoBin);
+        gst_element_set_state(pipeline.playbin, GST_STATE_NULL);
+        gst_object_unref(GST_OBJECT(pipeline.playbin));
+    }
+
+    if (pipelinesCreated_ > 0) {
+        LOG_INFO("Video", "Pipelines: " + std::to_string(pipelinesCreated_) + " created, " + std::to_string(pipelinesReused_) + " reused");
+    }
+}
+
+void GStreamerVideo::setPrerollCount(int count)
+{
+    std::lock_guard<std::mutex> lock(poolMutex_);
+    prerollCount_ = static_cast<size_t>(std::max(0, count));
+}
+
+void GStreamerVideo::setDecodeThreads(int threads)
+{
+    decodeThreads_ = threads;
+}
+
+void GStreamerVideo::preroll(const void* owner, size_t count, std::function<std::string(size_t)> findFile)
+{
+    unsigned int ticket;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        ticket = ++prerollTicket_;
+        prerollTickets_[owner] = ticket;
+    }
+    prerolls_.run([owner, ticket, count, findFile = std::move(findFile)] {
+        prerollFiles(owner, ticket, count, findFile);
+    });
+}
+
+void GStreamerVideo::releasePrerolled(const void* owner)
+{
+    std::vector<GStreamerVideo*> released;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        prerollTickets_.erase(owner);
+        for (auto it = prerolled_.begin(); it != prerolled_.end();) {
+            if (it->owner == owner) {
+                released.push_back(it->video);
+                it = prerolled_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+    for (GStreamerVideo* video : released) {
+        delete video;
+    }
+}
+
+bool GStreamerVideo::prerollCurrent(const void* owner, unsigned int ticket)
+{
+    auto it = prerollTickets_.find(owner);
+    return it != prerollTickets_.end() && it->second == ticket;
+}
+
+void GStreamerVideo::prerollFiles(const void* owner, unsigned int ticket, size_t count, std::function<std::string(size_t)> const& findFile)
+{
+    // The file lookups probe the disk, check between them whether the selection moved on
+    std::vector<std::string> files;
+    for (size_t i = 0; i < count; ++i) {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            if (!prerollCurrent(owner, ticket)) {
+                return;
+            }
+        }
+        std::string file = findFile(i);
+        if (!file.empty() && std::find(files.begin(), files.end(), file) == files.end()) {
+            files.push_back(file);
+        }
+    }
+
+    std::vector<GStreamerVideo*> released;
+    std::vector<std::string> missing;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        if (!prerollCurrent(owner, ticket)) {
+            return;
+        }
+        for (auto it = prerolled_.begin(); it != prerolled_.end();) {
+            if (it->owner == owner && std::find(files.begin(), files.end(), it->video->currentFile_) == files.end()) {
+                released.push_back(it->video);
+                it = prerolled_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+
+        for (size_t i = 0; i < files.size() && i < prerollCount_; ++i) {
+            auto prerolled = [&files, i](Prerolled const& entry) { return entry.video->currentFile_ == files[i]; };
+            if (std::none_of(prerolled_.begin(), prerolled_.end(), prerolled)) {
+                missing.push_back(files[i]);
+            }
+        }
+    }
+
+    // Stopping outside the lock, their pipelines go back to the pool
+    for (GStreamerVideo* video : released) {
+        delete video;
+    }
+
+    for (std::string const& file : missing) {
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            if (!prerollCurrent(owner, ticket)) {
+                return;
+            }
+        }
+
+        auto* video = new GStreamerVideo(0);
+        video->initialize();
+        if (!video->prerollFile(file)) {
+            delete video;
+            continue;
+        }
+
+        GStreamerVideo* evicted = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(poolMutex_);
+            auto owned = [owner](Prerolled const& entry) { return entry.owner == owner; };
+            if (prerollCount_ == 0 || !prerollCurrent(owner, ticket)) {
+                evicted = video;
+            }
+            else {
+                // The owner's oldest one is the least likely to be selected next
+                if (static_cast<size_t>(std::count_if(prerolled_.begin(), prerolled_.end(), owned)) >= prerollCount_) {
+                    auto oldest = std::find_if(prerolled_.begin(), prerolled_.end(), owned);
+                    evicted = oldest->video;
+                    prerolled_.erase(oldest);
+                }
+                prerolled_.push_back({ owner, video });
+            }
+        }
+        delete evicted;
+    }
+}
+
+bool GStreamerVideo::prerollFile(const std::string& file)
+{
+    currentFile_ = file;
+    if (!initializeGstElements(file)) {
+        return false;
+    }
 
+    // PAUSED decodes up to the first frame and holds it in the appsink
+    if (gst_element_set_state(playbin_, GST_STATE_PAUSED) == GST_STATE_CHANGE_FAILURE) {
+        LOG_WARNING("Video", "Unable to preroll " + Utils::getFileName(file));
+        return false;
+    }
+    return true;
+}
+
+bool GStreamerVideo::adoptPrerolled(const std::string& file)
+{
+    bool hardware = useD3dHardware_ || useVaHardware_;
+    GStreamerVideo* source = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex_);
+        for (auto it = prerolled_.begin(); it != prerolled_.end(); ++it) {
+            GStreamerVideo* video = it->video;
+            if (video->currentFile_ == file && (video->useD3dHardware_ || video->useVaHardware_) == hardware) {
+                source = video;
+                prerolled_.erase(it);
+                break;
+            }
+        }
+    }
+
+    if (!source) {
+        return false;
+    }
+
+    // Take over the pipeline, leaving source with nothing to stop
+    g_signal_handler_disconnect(source->playbin_, source->elementSetupHandlerId_);
+    source->elementSetupHandlerId_ = 0;
+    playbin_ = std::exchange(source->playbin_, nullptr);
+    videoBin_ = std::exchange(source->videoBin_, nullptr);
+    videoSink_ = std::exchange(source->videoSink_, nullptr);
+    videoBus_ = std::exchange(source->videoBus_, nullptr);
+    looping_ = std::move(source->looping_);
+    delete source;
+
+    elementSetupHandlerId_ = g_signal_connect(playbin_, "element-setup", G_CALLBACK(elementSetupCallback), this);
+    reusedPipeline_ = false;
+    prerolledPipeline_ = true;
     return true;
 }
 
@@ -308,7 +667,9 @@ void GStreamerVideo::elementSetupCallback([[maybe_unused]] GstElement const* pla
     if (!Configuration::HardwareVideoAccel) {
         if (g_str_has_prefix(elementName, "avdec_h26")) {
             // Modify the properties of the avdec_h265 element here
-            g_object_set(G_OBJECT(element), "thread-type", Configuration::AvdecThreadType, "max-threads", Configuration::AvdecMaxThreads, "direct-rendering", false, nullptr);
+            // The governor's share of the cores, taken when the decoder opens
+            int threads = decodeThreads_ > 0 ? decodeThreads_.load() : Configuration::AvdecMaxThreads;
+            g_object_set(G_OBJECT(element), "thread-type", Configuration::AvdecThreadType, "max-threads", threads, "direct-rendering", false, nullptr);
         }
     }
 #ifdef WIN32
@@ -322,129 +683,240 @@ void GStreamerVideo::elementSetupCallback([[maybe_unused]] GstElement const* pla
 
 
 
-void GStreamerVideo::processNewBuffer(GstElement const* /* fakesink */, GstBuffer* buf, GstPad* new_pad, gpointer userdata) {
-    GStreamerVideo* video = (GStreamerVideo*)userdata;
+void GStreamerVideo::update(float /* dt */)
+{
+    if (!isPlaying_ || !videoSink_) {
+        return;
+    }
 
-    SDL_LockMutex(SDL::getMutex());
-    if (video && video->isPlaying_ && !video->frameReady_) {
-        // Retrieve caps and set width/height if not yet set.
-        if (!video->width_ || !video->height_) {
-            GstCaps* caps = gst_pad_get_current_caps(new_pad);
-            if (caps) {
-                GstStructure* s = gst_caps_get_structure(caps, 0);
-                gst_structure_get_int(s, "width", &video->width_);
-                gst_structure_get_int(s, "height", &video->height_);
-                gst_caps_unref(caps);
-            }
+    // Never blocks, the appsink holds at most the newest decoded frame
+    GstSample* sample = gst_app_sink_try_pull_sample(GST_APP_SINK(videoSink_), 0);
+    if (!sample) {
+        return;
+    }
+
+    // Retrieve caps and set width/height if not yet set.
+    if (!width_ || !height_) {
+        if (GstCaps const* caps = gst_sample_get_caps(sample)) {
+            GstStructure const* s = gst_caps_get_structure(caps, 0);
+            gint width = 0;
+            gint height = 0;
+            gst_structure_get_int(s, "width", &width);
+            gst_structure_get_int(s, "height", &height);
+            width_ = width;
+            height_ = height;
         }
+    }
 
-        if (video->height_ && video->width_) {
-            // Clear the existing videoBuffer_ if it exists.
-            if (video->videoBuffer_) {
-                gst_clear_buffer(&video->videoBuffer_);
-            }
-            // Make a copy of the incoming buffer and set it as the new videoBuffer_.
-            video->videoBuffer_ = gst_buffer_copy(buf);
-            video->frameReady_ = true;
+    if (!width_ || !height_) {
+        gst_sample_unref(sample);
+        return;
+    }
+
+    framesPulled_++;
+    if (Benchmark::isActive()) {
+        // A timestamp going back is the loop seam, the wall time since the frame before
+        // it is how long the loop kept the screen still
+        Uint64 now = SDL_GetPerformanceCounter();
+        GstClockTime pts = GST_BUFFER_PTS(gst_sample_get_buffer(sample));
+        if (lastPull_ && GST_CLOCK_TIME_IS_VALID(pts) && GST_CLOCK_TIME_IS_VALID(lastPts_) && pts < lastPts_) {
+            Benchmark::videoLooped(static_cast<double>(now - lastPull_) / static_cast<double>(SDL_GetPerformanceFrequency()));
+        }
+        lastPull_ = now;
+        lastPts_ = pts;
+    }
+    if (GstSample* stale = frames_.publish(sample)) {
+        framesReplaced_++;
+        gst_sample_unref(stale);
+    }
+
+    if (playStart_) {
+        // The first frame of a video without a poster becomes its poster
+        if (std::string posterFile; PosterCache::claim(currentFile_, posterFile)) {
+            GstSample* frame = gst_sample_ref(sample);
+            ThreadPool::instance().submit([frame, posterFile] {
+                writePoster(frame, posterFile);
+                gst_sample_unref(frame);
+                PosterCache::release(posterFile);
+            });
+        }
+
+        double seconds = static_cast<double>(SDL_GetPerformanceCounter() - playStart_) / static_cast<double>(SDL_GetPerformanceFrequency());
+        playStart_ = 0;
+        if (Benchmark::isActive()) {
+            Benchmark::videoStarted(prerolledPipeline_ ? Benchmark::VideoStartPrerolled :
+                reusedPipeline_ ? Benchmark::VideoStartPooled : Benchmark::VideoStartNew, seconds);
+        }
+        if (Logger::isLevelEnabled("DEBUG")) {
+            LOG_DEBUG("Video", "First frame of " + Utils::getFileName(currentFile_) + " after " + std::to_string(static_cast<int>(seconds * 1000)) +
+                (prerolledPipeline_ ? "ms on a prerolled pipeline" : reusedPipeline_ ? "ms on a pooled pipeline" : "ms on a new pipeline"));
         }
     }
-    SDL_UnlockMutex(SDL::getMutex());
 }
 
 
-void GStreamerVideo::update(float /* dt */)
+void GStreamerVideo::writePoster(GstSample* sample, const std::string& file)
 {
+    GstCaps* caps = gst_caps_from_string("image/jpeg");
+    GError* error = nullptr;
+    GstSample* poster = gst_video_convert_sample(sample, caps, 5 * GST_SECOND, &error);
+    gst_caps_unref(caps);
+    if (!poster) {
+        LOG_WARNING("Video", "Could not encode poster " + file + ": " + (error ? error->message : "unknown error"));
+        g_clear_error(&error);
+        return;
+    }
 
-    if (!playbin_ || !videoBuffer_ || paused_) {
-         return;
+    // Written aside and renamed, so a reader never sees half a file
+    std::string partial = file + ".part";
+    GstBuffer* buffer = gst_sample_get_buffer(poster);
+    GstMapInfo info;
+    if (buffer && gst_buffer_map(buffer, &info, GST_MAP_READ)) {
+        std::ofstream out(partial, std::ios::binary);
+        out.write(reinterpret_cast<const char*>(info.data), static_cast<std::streamsize>(info.size));
+        out.close();
+        gst_buffer_unmap(buffer, &info);
+
+        std::error_code renameError;
+        if (out.good()) {
+            std::filesystem::rename(partial, file, renameError);
+        }
+        if (!out.good() || renameError) {
+            LOG_WARNING("Video", "Could not write poster " + file);
+            std::filesystem::remove(partial, renameError);
+        }
     }
-    
-    SDL_LockMutex(SDL::getMutex());
-    
-    if (!texture_ && width_ != 0) {
+    gst_sample_unref(poster);
+}
+
+
+void GStreamerVideo::logFrameCounts()
+{
+    // The sink counts frames it passed on and frames it skipped for arriving late. Passed
+    // on but never pulled means the appsink dropped them waiting for update().
+    guint64 rendered = 0;
+    guint64 late = 0;
+    GstStructure* stats = nullptr;
+    g_object_get(G_OBJECT(videoSink_), "stats", &stats, nullptr);
+    if (stats) {
+        gst_structure_get_uint64(stats, "rendered", &rendered);
+        gst_structure_get_uint64(stats, "dropped", &late);
+        gst_structure_free(stats);
+    }
+
+    unsigned int pulled = framesPulled_;
+    unsigned int shown = framesShown_;
+    unsigned int dropped = framesReplaced_ + static_cast<unsigned int>(rendered > pulled ? rendered - pulled : 0);
+    if (Benchmark::isActive()) {
+        Benchmark::videoFrames(shown, dropped, static_cast<unsigned int>(late), bytesUploaded_);
+    }
+    if (Logger::isLevelEnabled("DEBUG") && pulled > 0) {
+        // Dropped frames mean rendering could not keep up, late ones that decoding could not
+        LOG_DEBUG("Video", Utils::getFileName(currentFile_) + ": " + std::to_string(shown) + " frames shown, " +
+            std::to_string(dropped) + " dropped, " + std::to_string(late) + " late");
+    }
+}
+
+
+GStreamerVideo::Output& GStreamerVideo::outputFor(int monitor)
+{
+    for (Output& output : outputs_) {
+        if (output.monitor == monitor) {
+            return output;
+        }
+    }
+    outputs_.push_back({ monitor, nullptr, false });
+    return outputs_.back();
+}
+
+
+void GStreamerVideo::uploadFrame(GstBuffer* buffer, Output& output)
+{
+    SDL_Texture*& texture = output.texture;
+    if (!texture && frameWidth_ != 0) {
         if (useD3dHardware_ || useVaHardware_) {
-            texture_ = SDL_CreateTexture(SDL::getRenderer(monitor_), SDL_PIXELFORMAT_NV12,
-                SDL_TEXTUREACCESS_STREAMING, width_, height_);
+            texture = SDL_CreateTexture(SDL::getRenderer(output.monitor), SDL_PIXELFORMAT_NV12,
+                SDL_TEXTUREACCESS_STREAMING, frameWidth_, frameHeight_);
         }
         else {
-            texture_ = SDL_CreateTexture(SDL::getRenderer(monitor_), SDL_PIXELFORMAT_IYUV,
-                SDL_TEXTUREACCESS_STREAMING, width_, height_);
+            texture = SDL_CreateTexture(SDL::getRenderer(output.monitor), SDL_PIXELFORMAT_IYUV,
+                SDL_TEXTUREACCESS_STREAMING, frameWidth_, frameHeight_);
         }
-        SDL_SetTextureBlendMode(texture_, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
     }
 
-    if (videoBuffer_) {
+    if (buffer) {
         // Lambda functions for handling each case
         auto handleContiguous = [&]() {
                 GstMapInfo bufInfo;
-                gst_buffer_map(videoBuffer_, &bufInfo, GST_MAP_READ);
+                gst_buffer_map(buffer, &bufInfo, GST_MAP_READ);
                 if (bufInfo.size == expectedBufSize_) {
-                    SDL_UpdateTexture(texture_, nullptr, bufInfo.data, width_);
+                    SDL_UpdateTexture(texture, nullptr, bufInfo.data, frameWidth_);
                 }
                 else if (!Configuration::HardwareVideoAccel) {
                     int y_stride, u_stride, v_stride;
                     const Uint8* y_plane, * u_plane, * v_plane;
 
-                    y_stride = GST_ROUND_UP_4(width_);
+                    y_stride = GST_ROUND_UP_4(frameWidth_);
                     u_stride = v_stride = GST_ROUND_UP_4(y_stride / 2);
 
                     y_plane = bufInfo.data;
-                    u_plane = y_plane + (height_ * y_stride);
-                    v_plane = u_plane + ((height_ / 2) * u_stride);
-                    SDL_UpdateYUVTexture(texture_, nullptr,
+                    u_plane = y_plane + (frameHeight_ * y_stride);
+                    v_plane = u_plane + ((frameHeight_ / 2) * u_stride);
+                    SDL_UpdateYUVTexture(texture, nullptr,
                         y_plane, y_stride,
                         u_plane, u_stride,
                         v_plane, v_stride);
                 }
                 else {
                     if (!videoMeta_)
-                        videoMeta_ = gst_buffer_get_video_meta(videoBuffer_);
+                        videoMeta_ = gst_buffer_get_video_meta(buffer);
                     GstMapInfo bufInfo;
-                    if (!gst_buffer_map(videoBuffer_, &bufInfo, GST_MAP_READ))
+                    if (!gst_buffer_map(buffer, &bufInfo, GST_MAP_READ))
                         return; // Early return if mapping fails
 
                     void* pixels;
                     int pitch;
-                    if (SDL_LockTexture(texture_, nullptr, &pixels, &pitch) != 0) {
-                        gst_buffer_unmap(videoBuffer_, &bufInfo); // Unmap before returning
+                    if (SDL_LockTexture(texture, nullptr, &pixels, &pitch) != 0) {
+                        gst_buffer_unmap(buffer, &bufInfo); // Unmap before returning
                         return; // Early return if locking fails
                     }
 
                     // Directly access the Y plane data
                     const Uint8* y_plane = bufInfo.data + videoMeta_->offset[0];
                     // Copy the Y plane data row by row
-                    for (int row = 0; row < height_; ++row) {
+                    for (int row = 0; row < frameHeight_; ++row) {
                         Uint8* dst = static_cast<Uint8*>(pixels) + row * pitch; // Destination row in the texture
                         const Uint8* src = y_plane + row * videoMeta_->stride[0]; // Source row in the Y plane
-                        SDL_memcpy(dst, src, width_); // Assuming width is the actual visible width to copy
+                        SDL_memcpy(dst, src, frameWidth_); // Assuming width is the actual visible width to copy
                     }
 
                     // Directly access the UV plane data
                     const Uint8* uv_plane = bufInfo.data + videoMeta_->offset[1];
                     // Calculate the starting point for the UV plane in the texture's pixel buffer
-                    Uint8* uv_plane_pixels = static_cast<Uint8*>(pixels) + pitch * height_;
+                    Uint8* uv_plane_pixels = static_cast<Uint8*>(pixels) + pitch * frameHeight_;
                     // Copy the UV plane data row by row
-                    for (int row = 0; row < height_ / 2; ++row) {
+                    for (int row = 0; row < frameHeight_ / 2; ++row) {
                         Uint8* dst = uv_plane_pixels + row * pitch; // Destination row in the texture for UV data
                         const Uint8* src = uv_plane + row * videoMeta_->stride[1]; // Source row in the UV plane
-                        SDL_memcpy(dst, src, width_); // Copy the UV data, adjusting for NV12 format
+                        SDL_memcpy(dst, src, frameWidth_); // Copy the UV data, adjusting for NV12 format
                     }
 
-                    SDL_UnlockTexture(texture_); // Unlock after copying
-                    gst_buffer_unmap(videoBuffer_, &bufInfo); // Unmap the GstBuffer
+                    SDL_UnlockTexture(texture); // Unlock after copying
+                    gst_buffer_unmap(buffer, &bufInfo); // Unmap the GstBuffer
                     videoMeta_ = nullptr; // Reset videoMeta_ for the next frame
                 }
-                gst_buffer_unmap(videoBuffer_, &bufInfo); // Unmap the buffer after use
+                gst_buffer_unmap(buffer, &bufInfo); // Unmap the buffer after use
             };
 
         auto handleNonContiguous = [&]() {
             if (!videoMeta_)
-                videoMeta_ = gst_buffer_get_video_meta(videoBuffer_);
+                videoMeta_ = gst_buffer_get_video_meta(buffer);
             GstMapInfo bufInfo;
             const Uint8* y_plane, * u_plane, * v_plane;
             int y_stride, u_stride, v_stride;
 
-            gst_buffer_map(videoBuffer_, &bufInfo, GST_MAP_READ);
+            gst_buffer_map(buffer, &bufInfo, GST_MAP_READ);
 
             // Use videoMeta_ directly
             y_stride = videoMeta_->stride[0];
@@ -454,11 +926,11 @@ void GStreamerVideo::update(float /* dt */)
             y_plane = bufInfo.data + videoMeta_->offset[0];
             u_plane = bufInfo.data + videoMeta_->offset[1];
             v_plane = bufInfo.data + videoMeta_->offset[2];
-            SDL_UpdateYUVTexture(texture_, nullptr,
+            SDL_UpdateYUVTexture(texture, nullptr,
                 y_plane, y_stride,
                 u_plane, u_stride,
                 v_plane, v_stride);
-            gst_buffer_unmap(videoBuffer_, &bufInfo);
+            gst_buffer_unmap(buffer, &bufInfo);
             videoMeta_ = nullptr;
             };
 
@@ -468,7 +940,7 @@ void GStreamerVideo::update(float /* dt */)
 
         if (bufferLayout_ == UNKNOWN) {
             GstVideoMeta const* meta;
-            meta = gst_buffer_get_video_meta(videoBuffer_);
+            meta = gst_buffer_get_video_meta(buffer);
             if (!meta) {
                 bufferLayout_ = CONTIGUOUS;
                 if(Logger::isLevelEnabled("DEBUG"))
@@ -507,37 +979,110 @@ void GStreamerVideo::update(float /* dt */)
             break;
         }
 
-        gst_clear_buffer(&videoBuffer_);
 }
-
-    SDL_UnlockMutex(SDL::getMutex());
 }
 
 
 void GStreamerVideo::loopHandler()
 {
-    if(videoBus_) {
-        GstMessage *msg = gst_bus_pop_filtered(videoBus_, GST_MESSAGE_EOS);
-        if(msg) {
-            playCount_++;
-
-            // If the number of loops is 0 or greater than the current playCount_, seek the playback to the beginning.
-            if(!numLoops_ || numLoops_ > playCount_) {
-                gst_element_seek(playbin_,
-                             1.0,
-                             GST_FORMAT_TIME,
-                             GST_SEEK_FLAG_FLUSH,
-                             GST_SEEK_TYPE_SET,
-                             0,
-                             GST_SEEK_TYPE_NONE,
-                             GST_CLOCK_TIME_NONE);
-            }
-            else {
-                stop();
-            }
-            gst_message_unref(msg);
+    // busSyncHandler() does the looping, only the end of the last loop is left for here
+    if (looping_ && looping_->finished) {
+        stop();
+    }
+}
+
+
+GstBusSyncReply GStreamerVideo::busSyncHandler(GstBus* /* bus */, GstMessage* msg, gpointer data)
+{
+    Looping& looping = **static_cast<std::shared_ptr<Looping>*>(data);
+
+    // The pipeline itself posts the loop messages, so their source is the playbin to seek.
+    // Seeking is handed to GStreamer's own thread, a streaming thread must not seek its pipeline.
+    GstElement* playbin = GST_ELEMENT(GST_MESSAGE_SRC(msg));
+    switch (GST_MESSAGE_TYPE(msg)) {
+    case GST_MESSAGE_ASYNC_DONE:
+        // Once prerolled, play the file as a segment. Its end then posts SEGMENT_DONE
+        // with the pipeline still running, rather than EOS with the pipeline drained.
+        // Only the mode changes, so no flush throws away the frames already decoded.
+        if (!looping.segmented.exchange(true)) {
+            gst_element_call_async(playbin, segmentSeek, nullptr, nullptr);
         }
+        break;
+
+    case GST_MESSAGE_SEGMENT_DONE:
+    case GST_MESSAGE_EOS: {
+        int played = ++looping.playCount;
+        int numLoops = looping.numLoops;
+        if (!numLoops || numLoops > played) {
+            // Without a flush the frames already queued keep playing while the demuxer
+            // starts over, so the loop shows no gap. EOS means the file would not play as
+            // a segment and only a flushing seek restarts it.
+            int flags = GST_MESSAGE_TYPE(msg) == GST_MESSAGE_EOS ? GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_SEGMENT : GST_SEEK_FLAG_SEGMENT;
+            gst_element_call_async(playbin, loopSeek, GINT_TO_POINTER(flags), nullptr);
+        }
+        else {
+            looping.finished = true;
+        }
+        break;
     }
+
+    case GST_MESSAGE_ERROR: {
+        // The video cannot go on, loopHandler() stops it like one that played its loops
+        GError* error = nullptr;
+        gchar* debug = nullptr;
+        gst_message_parse_error(msg, &error, &debug);
+        LOG_ERROR("Video", std::string(GST_MESSAGE_SRC_NAME(msg)) + ": " + (error ? error->message : "unknown error") +
+            (debug ? std::string(" (") + debug + ")" : ""));
+        g_clear_error(&error);
+        g_free(debug);
+        looping.finished = true;
+        break;
+    }
+
+    case GST_MESSAGE_WARNING: {
+        GError* warning = nullptr;
+        gchar* debug = nullptr;
+        gst_message_parse_warning(msg, &warning, &debug);
+        LOG_WARNING("Video", std::string(GST_MESSAGE_SRC_NAME(msg)) + ": " + (warning ? warning->message : "unknown warning"));
+        g_clear_error(&warning);
+        g_free(debug);
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    // Everything that needs handling is handled here and nothing polls the bus, so
+    // passing messages on would only pile them up
+    return GST_BUS_DROP;
+}
+
+
+void GStreamerVideo::segmentSeek(GstElement* playbin, gpointer /* data */)
+{
+    // Keeps the position, only asks for SEGMENT_DONE instead of EOS at the end
+    gst_element_seek(playbin,
+                     1.0,
+                     GST_FORMAT_TIME,
+                     GST_SEEK_FLAG_SEGMENT,
+                     GST_SEEK_TYPE_NONE,
+                     0,
+                     GST_SEEK_TYPE_NONE,
+                     GST_CLOCK_TIME_NONE);
+}
+
+
+void GStreamerVideo::loopSeek(GstElement* playbin, gpointer flags)
+{
+    gst_element_seek(playbin,
+                     1.0,
+                     GST_FORMAT_TIME,
+                     static_cast<GstSeekFlags>(GPOINTER_TO_INT(flags)),
+                     GST_SEEK_TYPE_SET,
+                     0,
+                     GST_SEEK_TYPE_NONE,
+                     GST_CLOCK_TIME_NONE);
 }
 
 void GStreamerVideo::volumeUpdate()
@@ -585,7 +1130,79 @@ int GStreamerVideo::getWidth()
 
 void GStreamerVideo::draw()
 {
-    frameReady_ = false;
+    drawOn(monitor_);
+}
+
+
+void GStreamerVideo::releaseOutput(int monitor)
+{
+    if (monitor >= 0 && monitor < 32) {
+        releasedOutputs_.fetch_or(1u << monitor);
+    }
+}
+
+
+void GStreamerVideo::drawOn(int monitor)
+{
+    FrameProfiler::Scope upload(FrameProfiler::PhaseVideo);
+
+    // A monitor nobody shows the video on must not keep the frame from going back
+    if (unsigned int released = releasedOutputs_.exchange(0)) {
+        for (auto it = outputs_.begin(); it != outputs_.end();) {
+            if (it->monitor >= 0 && it->monitor < 32 && (released & (1u << it->monitor))) {
+                SDL::destroyTexture(it->texture);
+                it = outputs_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    GstSample* sample = nullptr;
+    if (playbin_ && !paused_ && frames_.take(sample)) {
+        // New caps after a renegotiation may bring a new size, which needs a new texture
+        if (GstCaps* caps = gst_sample_get_caps(sample); caps && caps != frameCaps_) {
+            gst_caps_replace(&frameCaps_, caps);
+            gint width = 0;
+            gint height = 0;
+            GstStructure const* s = gst_caps_get_structure(caps, 0);
+            gst_structure_get_int(s, "width", &width);
+            gst_structure_get_int(s, "height", &height);
+            if (width != frameWidth_ || height != frameHeight_) {
+                frameWidth_ = width;
+                frameHeight_ = height;
+                for (Output& output : outputs_) {
+                    SDL::destroyTexture(output.texture);
+                    output.texture = nullptr;
+                }
+                bufferLayout_ = UNKNOWN;
+                videoMeta_ = nullptr;
+            }
+        }
+
+        if (frame_) {
+            gst_sample_unref(frame_);
+        }
+        frame_ = sample;
+        for (Output& output : outputs_) {
+            output.current = false;
+        }
+        framesShown_++;
+    }
+
+    Output& output = outputFor(monitor);
+    if (frame_ && !output.current) {
+        uploadFrame(gst_sample_get_buffer(frame_), output);
+        output.current = true;
+        bytesUploaded_ += static_cast<guint64>(frameWidth_) * frameHeight_ * 3 / 2;
+    }
+
+    // Hand the buffer back to the decoder once every monitor showing the video has it
+    if (frame_ && std::all_of(outputs_.begin(), outputs_.end(), [](const Output& o) { return o.current; })) {
+        gst_sample_unref(frame_);
+        frame_ = nullptr;
+    }
 }
 
 
@@ -619,7 +1236,7 @@ void GStreamerVideo::skipForward( )
     current += 60 * GST_SECOND;
     if ( current > duration )
         current = duration-1;
-    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT ), current );
+    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SEGMENT ), current );
 
 }
 
@@ -639,7 +1256,7 @@ void GStreamerVideo::skipBackward( )
         current -= 60 * GST_SECOND;
     else
         current = 0;
-    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT ), current );
+    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SEGMENT ), current );
 
 }
 
@@ -662,7 +1279,7 @@ void GStreamerVideo::skipForwardp( )
     current += duration/20;
     if ( current > duration )
         current = duration-1;
-    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT ), current );
+    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SEGMENT ), current );
 
 }
 
@@ -686,7 +1303,7 @@ void GStreamerVideo::skipBackwardp( )
         current -= duration/20;
     else
         current = 0;
-    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT ), current );
+    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_KEY_UNIT | GST_SEEK_FLAG_SEGMENT ), current );
 
 }
 
@@ -708,7 +1325,7 @@ void GStreamerVideo::restart( )
     if ( !isPlaying_ )
         return;
 
-    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH), 0 );
+    gst_element_seek_simple( playbin_, GST_FORMAT_TIME, GstSeekFlags( GST_SEEK_FLAG_FLUSH | GST_SEEK_FLAG_SEGMENT ), 0 );
 
 }
 
@@ -738,7 +1355,49 @@ bool GStreamerVideo::isPaused( )
 
 bool GStreamerVideo::getFrameReady()
 {
-    return frameReady_;
+    return frames_.hasNew();
+}
+
+void GStreamerVideo::setTargetSize(int width, int height)
+{
+    if (!videoSink_ || width <= 0 || height <= 0) {
+        return;
+    }
+    if (targetWidth_ && width <= targetWidth_ && height <= targetHeight_) {
+        return;
+    }
+
+    // Grow with headroom, so a zooming tween renegotiates once or twice rather than every frame
+    bool growing = targetWidth_ != 0;
+    auto roundUp = [growing](int size) { return ((growing ? size * 3 / 2 : size) + 15) & ~15; };
+    targetWidth_ = roundUp(width);
+    targetHeight_ = roundUp(height);
+
+    GstCaps* caps = sinkCaps(targetWidth_, targetHeight_);
+    gst_app_sink_set_caps(GST_APP_SINK(videoSink_), caps);
+    gst_caps_unref(caps);
+
+    // Ask upstream to renegotiate, the converter playbin3 puts in front of the sink bin
+    // then scales before the frame is copied to the appsink
+    GstPad* pad = gst_element_get_static_pad(videoSink_, "sink");
+    if (pad) {
+        gst_pad_push_event(pad, gst_event_new_reconfigure());
+        gst_object_unref(pad);
+    }
+
+    if (Logger::isLevelEnabled("DEBUG")) {
+        LOG_DEBUG("Video", "Decoding " + Utils::getFileName(currentFile_) + " at up to " + std::to_string(targetWidth_) + "x" + std::to_string(targetHeight_));
+    }
+}
+
+void GStreamerVideo::setPriority(Priority /* priority */)
+{
+    // Decodes are governed per shared session, see SharedVideo::govern()
+}
+
+bool GStreamerVideo::isThrottled()
+{
+    return false;
 }
 
 std::string GStreamerVideo::generateDotFileName(const std::string& prefix, const std::string& videoFilePath) {
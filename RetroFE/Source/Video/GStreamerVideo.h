@@ -18,7 +18,14 @@
 #include "IVideo.h"
 #include "../SDL.h"
 #include "../Database/Configuration.h"
+#include "../Utility/TripleBuffer.h"
 #include "../Utility/Utils.h"
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 extern "C"
 {
 #if (__APPLE__)
@@ -34,6 +41,7 @@ extern "C"
 
 }
 
+class TaskGroup;
 
 class GStreamerVideo final : public IVideo
 {
@@ -47,10 +55,17 @@ public:
     bool stop() override;
     bool deInitialize() override;
     SDL_Texture* getTexture() const override;
+    // The texture holding the newest frame on another monitor's renderer, for a video
+    // several components on different monitors share
+    SDL_Texture* getTexture(int monitor) const;
     void update(float dt) override;
     void loopHandler() override;
     void volumeUpdate() override;
     void draw() override;
+    void drawOn(int monitor);
+    // Drops the texture for monitor once nothing draws the video there any more. Safe from
+    // any thread, the next drawOn() on the render thread lets it go.
+    void releaseOutput(int monitor);
     void setNumLoops(int n);
     int getHeight() override;
     int getWidth() override;
@@ -66,9 +81,27 @@ public:
     unsigned long long getDuration() override;
     bool isPaused() override;
     bool getFrameReady() override;
+    void setTargetSize(int width, int height) override;
+    void setPriority(Priority priority) override;
+    bool isThrottled() override;
     // Helper functions...
     static void enablePlugin(const std::string& pluginName);
     static void disablePlugin(const std::string& pluginName);
+    static void setPoolSize(int size);
+    // Takes down the idle and prerolled pipelines and logs how many were built and reused
+    static void clearPool();
+    // Keeps files decoded up to their first frame in PAUSED, so play() on one of them only
+    // has to start it. findFile(i) names the file of the i-th of count items, "" for none.
+    // The lookup and the prerolls run on the thread pool, and a newer request from the
+    // same owner supersedes this one. Files owner asked for before but no longer lists
+    // are released. Each owner keeps up to the preroll count, so the total is that many
+    // per owner.
+    static void preroll(const void* owner, size_t count, std::function<std::string(size_t)> findFile);
+    // Cancels owner's pending request and releases what it has prerolled
+    static void releasePrerolled(const void* owner);
+    static void setPrerollCount(int count);
+    // Decoder threads each software decoder opened from now on gets, 0 for AvdecMaxThreads
+    static void setDecodeThreads(int threads);
 
 private:
     enum BufferLayout {
@@ -77,25 +110,102 @@ private:
         NON_CONTIGUOUS,  // Non-contiguous buffer layout
     };
 
-    static void processNewBuffer(GstElement const*/* fakesink */, GstBuffer* buf, GstPad* new_pad, gpointer userdata);
+    // A playbin3 with its sink bin, parked in READY until the next video needs one
+    struct Pipeline {
+        GstElement* playbin;
+        GstElement* videoBin;
+        GstElement* videoSink;
+        bool hardware;
+    };
+
+    // A texture on one monitor's renderer and whether it has the newest frame yet
+    struct Output {
+        int monitor;
+        SDL_Texture* texture;
+        bool current;
+    };
+
+    // Loop bookkeeping shared with the bus sync handler, which runs on streaming threads
+    struct Looping {
+        std::atomic<int> numLoops{ 0 };
+        std::atomic<int> playCount{ 0 };
+        std::atomic<bool> segmented{ false };
+        std::atomic<bool> finished{ false };
+    };
+
+    // A video waiting in PAUSED for play() to take over its pipeline
+    struct Prerolled {
+        const void* owner;
+        GStreamerVideo* video;
+    };
+
+    void uploadFrame(GstBuffer* buffer, Output& output);
+    Output& outputFor(int monitor);
+    GstCaps* sinkCaps(int maxWidth, int maxHeight) const;
+    bool createPipeline();
+    bool poolPipeline();
+    bool prerollFile(const std::string& file);
+    bool adoptPrerolled(const std::string& file);
+    static void prerollFiles(const void* owner, unsigned int ticket, size_t count, std::function<std::string(size_t)> const& findFile);
+    // Whether ticket is still owner's newest request, with poolMutex_ held
+    static bool prerollCurrent(const void* owner, unsigned int ticket);
+    void logFrameCounts();
+    static void writePoster(GstSample* sample, const std::string& file);
+    static GstBusSyncReply busSyncHandler(GstBus* bus, GstMessage* msg, gpointer data);
+    static void loopSeek(GstElement* playbin, gpointer flags);
+    static void segmentSeek(GstElement* playbin, gpointer data);
     static void elementSetupCallback([[maybe_unused]] GstElement const* playbin, GstElement* element, [[maybe_unused]] GStreamerVideo const* video);
     bool initializeGstElements(const std::string& file);
     GstElement* playbin_{ nullptr };
     GstElement* videoBin_{ nullptr };
     GstElement* videoSink_{ nullptr };
-    GstElement* capsFilter_{ nullptr };
     GstBus* videoBus_{ nullptr };
-    SDL_Texture* texture_{ nullptr };
+    std::shared_ptr<Looping> looping_;
+    std::vector<Output> outputs_;
+    // Monitors whose output releaseOutput() asked to drop, one bit each
+    std::atomic<unsigned int> releasedOutputs_{ 0 };
     gulong elementSetupHandlerId_{ 0 };
-    gulong handoffHandlerId_{ 0 };
-    gint height_{ 0 };
-    gint width_{ 0 };
-    GstBuffer* videoBuffer_{ nullptr };
+    // Set from the first sample's caps
+    std::atomic<gint> height_{ 0 };
+    std::atomic<gint> width_{ 0 };
+    // Samples pulled by update() on their way to draw(), which may run on another thread
+    TripleBuffer<GstSample*> frames_;
     const GstVideoMeta* videoMeta_{ nullptr };
-    bool frameReady_{ false };
-    bool isPlaying_{ false };
+    // Frames pulled from the appsink, uploaded by draw(), and pulled but replaced by a
+    // newer one before draw() got to them
+    std::atomic<unsigned int> framesPulled_{ 0 };
+    std::atomic<unsigned int> framesShown_{ 0 };
+    std::atomic<unsigned int> framesReplaced_{ 0 };
+    std::atomic<guint64> bytesUploaded_{ 0 };
+    // Size the sink asks for, 0 while it takes the native size
+    int targetWidth_{ 0 };
+    int targetHeight_{ 0 };
+    // The newest frame, held until every output has uploaded it, and its caps and size.
+    // Only touched by draw().
+    GstSample* frame_{ nullptr };
+    GstCaps* frameCaps_{ nullptr };
+    int frameWidth_{ 0 };
+    int frameHeight_{ 0 };
+    Uint64 playStart_{ 0 };
+    // When update() pulled the previous frame and its timestamp, for timing the loop seam
+    Uint64 lastPull_{ 0 };
+    GstClockTime lastPts_{ GST_CLOCK_TIME_NONE };
+    bool reusedPipeline_{ false };
+    bool prerolledPipeline_{ false };
+    std::atomic<bool> isPlaying_{ false };
     static bool initialized_;
-    int playCount_{ 0 };
+    static std::mutex poolMutex_;
+    static std::vector<Pipeline> pool_;
+    static size_t poolSize_;
+    static std::vector<Prerolled> prerolled_;
+    static size_t prerollCount_;
+    // Each owner's newest preroll request; a task whose ticket is no longer here stops
+    static std::map<const void*, unsigned int> prerollTickets_;
+    static unsigned int prerollTicket_;
+    static TaskGroup prerolls_;
+    static std::atomic<int> decodeThreads_;
+    static std::atomic<unsigned int> pipelinesCreated_;
+    static std::atomic<unsigned int> pipelinesReused_;
     std::string currentFile_{};
     int numLoops_{ 0 };
     float volume_{ 0.0f };
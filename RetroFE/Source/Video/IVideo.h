@@ -21,6 +21,14 @@
 class IVideo
 {
 public:
+    // How much a video matters when not all of them can decode at once
+    enum Priority
+    {
+        PriorityOffscreen,
+        PriorityVisible,
+        PrioritySelected
+    };
+
     virtual ~IVideo() = default;
     virtual bool initialize() = 0;
     virtual bool play(const std::string& file) = 0;
@@ -45,4 +53,9 @@ public:
     virtual bool isPaused( ) = 0;
     virtual bool isPlaying() = 0;
     virtual bool getFrameReady() = 0;
+    // Largest size the video is drawn at in screen pixels, so it can be decoded no bigger
+    virtual void setTargetSize(int width, int height) = 0;
+    virtual void setPriority(Priority priority) = 0;
+    // Held back by the decode governor: not paused, but no new frames are coming
+    virtual bool isThrottled() = 0;
 };
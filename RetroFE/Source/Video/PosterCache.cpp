@@ -0,0 +1,133 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "PosterCache.h"
+#include "../Database/Configuration.h"
+#include "../Graphics/ThreadPool.h"
+#include "../Utility/Log.h"
+#include "../Utility/Utils.h"
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#if (__APPLE__)
+    #include <SDL2_image/SDL_image.h>
+#else
+    #include <SDL2/SDL_image.h>
+#endif
+
+namespace fs = std::filesystem;
+
+bool PosterCache::enabled_ = true;
+std::mutex PosterCache::mutex_;
+std::string PosterCache::writing_;
+
+PosterCache::Poster::~Poster()
+{
+    if (SDL_Surface* surface = surface_.exchange(nullptr)) {
+        SDL_FreeSurface(surface);
+    }
+}
+
+SDL_Surface* PosterCache::Poster::take()
+{
+    return surface_.exchange(nullptr);
+}
+
+void PosterCache::setEnabled(bool enabled)
+{
+    enabled_ = enabled;
+}
+
+bool PosterCache::isEnabled()
+{
+    return enabled_;
+}
+
+std::string PosterCache::posterPath(const std::string& videoFile)
+{
+    std::error_code error;
+    auto modified = fs::last_write_time(videoFile, error);
+    if (error) {
+        return "";
+    }
+
+    // A changed video gets a new name, so a stale poster is never shown
+    std::stringstream name;
+    name << std::hex << std::hash<std::string>{}(videoFile) << "_" << modified.time_since_epoch().count() << ".jpg";
+    return Utils::combinePath(Configuration::absolutePath, "cache", "posters", name.str());
+}
+
+std::shared_ptr<PosterCache::Poster> PosterCache::load(const std::string& videoFile)
+{
+    if (!enabled_) {
+        return nullptr;
+    }
+
+    std::string file = posterPath(videoFile);
+    std::error_code error;
+    if (file.empty() || !fs::exists(file, error)) {
+        return nullptr;
+    }
+
+    // The task keeps the poster alive, whoever lets go last frees the surface
+    auto poster = std::make_shared<Poster>();
+    ThreadPool::instance().submit([poster, file] {
+        poster->surface_ = IMG_Load(file.c_str());
+        if (!poster->surface_) {
+            LOG_WARNING("PosterCache", "Could not read " + file + ": " + IMG_GetError());
+        }
+    });
+    return poster;
+}
+
+bool PosterCache::claim(const std::string& videoFile, std::string& posterFile)
+{
+    if (!enabled_) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!writing_.empty()) {
+            return false;
+        }
+    }
+
+    posterFile = posterPath(videoFile);
+    std::error_code error;
+    if (posterFile.empty() || fs::exists(posterFile, error)) {
+        return false;
+    }
+
+    fs::create_directories(fs::path(posterFile).parent_path(), error);
+    if (error) {
+        LOG_WARNING("PosterCache", "Could not create " + fs::path(posterFile).parent_path().string() + ": " + error.message());
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!writing_.empty()) {
+        return false;
+    }
+    writing_ = posterFile;
+    return true;
+}
+
+void PosterCache::release(const std::string& posterFile)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (writing_ == posterFile) {
+        writing_.clear();
+    }
+}
@@ -0,0 +1,62 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// First frames of videos, stored as JPEGs under cache/posters and keyed by the video's
+// path and modification time, so a video can show something while its pipeline starts.
+// Posters are written the first time a video plays and read on the thread pool.
+class PosterCache
+{
+public:
+    // A poster being read in the background
+    class Poster
+    {
+    public:
+        ~Poster();
+        // The decoded poster once it is ready, the caller frees it. Null until then.
+        SDL_Surface* take();
+
+    private:
+        friend class PosterCache;
+        std::atomic<SDL_Surface*> surface_{ nullptr };
+    };
+
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    // Starts reading the poster of videoFile, null when there is none
+    static std::shared_ptr<Poster> load(const std::string& videoFile);
+
+    // Hands out the file to write videoFile's poster to, false when it exists already or
+    // another poster is being written. Only one write is in flight at a time so the
+    // conversions cannot tie up the pool; a skipped poster is written on a later play.
+    // Call release() once done.
+    static bool claim(const std::string& videoFile, std::string& posterFile);
+    static void release(const std::string& posterFile);
+
+private:
+    static std::string posterPath(const std::string& videoFile);
+
+    static bool enabled_;
+    static std::mutex mutex_;
+    static std::string writing_;
+};
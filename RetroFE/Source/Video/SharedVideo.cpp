@@ -0,0 +1,376 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "SharedVideo.h"
+#include "GStreamerVideo.h"
+#include "../Database/Configuration.h"
+#include "../Execute/Benchmark.h"
+#include "../Utility/Log.h"
+#include "../Utility/Utils.h"
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+std::mutex SharedVideo::mutex_;
+std::vector<std::unique_ptr<SharedVideo::Session>> SharedVideo::sessions_;
+int SharedVideo::maxDecodes_ = 0;
+size_t SharedVideo::lastRunning_ = 0;
+size_t SharedVideo::lastThrottled_ = 0;
+
+SharedVideo::SharedVideo(int monitor, int numLoops)
+    : monitor_(monitor)
+    , numLoops_(numLoops)
+{
+}
+
+SharedVideo::~SharedVideo()
+{
+    leave();
+}
+
+bool SharedVideo::initialize()
+{
+    return true;
+}
+
+bool SharedVideo::play(const std::string& file)
+{
+    leave();
+
+    bool joined;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        joined = joinSession(file);
+    }
+
+    if (!joined) {
+        // Starting a pipeline takes a while, so it happens outside the lock
+        auto* video = new GStreamerVideo(monitor_);
+        video->initialize();
+        video->setNumLoops(numLoops_);
+        if (!video->play(file)) {
+            delete video;
+            return false;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // Another component may have started the same file in the meantime
+            joined = joinSession(file);
+            if (!joined) {
+                auto session = std::make_unique<Session>();
+                session->file = file;
+                session->numLoops = numLoops_;
+                session->video = video;
+                session->subscribers.push_back(this);
+                session->throttled = false;
+                session_ = session.get();
+                sessions_.push_back(std::move(session));
+                return true;
+            }
+        }
+        delete video;
+    }
+
+    // A decode that ran through its loops starts over for the newcomer
+    bool playing;
+    {
+        std::lock_guard<std::mutex> control(session_->control);
+        playing = session_->video->isPlaying() || session_->video->play(file);
+    }
+    if (!playing) {
+        leave();
+    }
+    return playing;
+}
+
+bool SharedVideo::joinSession(const std::string& file)
+{
+    for (const auto& session : sessions_) {
+        if (session->file == file && session->numLoops == numLoops_) {
+            session->subscribers.push_back(this);
+            session_ = session.get();
+            if (Logger::isLevelEnabled("DEBUG")) {
+                LOG_DEBUG("Video", Utils::getFileName(file) + " is decoded once for " + std::to_string(session_->subscribers.size()) + " components");
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void SharedVideo::leave()
+{
+    GStreamerVideo* finished = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!session_) {
+            return;
+        }
+        auto& subscribers = session_->subscribers;
+        subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), this), subscribers.end());
+        if (subscribers.empty()) {
+            finished = session_->video;
+            sessions_.erase(std::remove_if(sessions_.begin(), sessions_.end(),
+                [this](const std::unique_ptr<Session>& session) { return session.get() == session_; }), sessions_.end());
+        }
+        else if (std::none_of(subscribers.begin(), subscribers.end(),
+                     [this](const SharedVideo* subscriber) { return subscriber->monitor_ == monitor_; })) {
+            session_->video->releaseOutput(monitor_);
+        }
+        session_ = nullptr;
+    }
+
+    // Stopped outside the lock, handing the pipeline back to the pool takes a moment
+    delete finished;
+}
+
+bool SharedVideo::isDriver()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return session_ && session_->subscribers.front() == this;
+}
+
+bool SharedVideo::stop()
+{
+    leave();
+    return true;
+}
+
+bool SharedVideo::deInitialize()
+{
+    leave();
+    return true;
+}
+
+SDL_Texture* SharedVideo::getTexture() const
+{
+    return session_ ? session_->video->getTexture(monitor_) : nullptr;
+}
+
+void SharedVideo::update(float dt)
+{
+    if (!session_) {
+        return;
+    }
+
+    float volume = 0.0f;
+    bool paused = true;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (session_->subscribers.front() != this) {
+            return;
+        }
+        for (const SharedVideo* subscriber : session_->subscribers) {
+            volume = std::max(volume, subscriber->volume_.load());
+            paused = paused && subscriber->paused_;
+        }
+        paused = paused || session_->throttled;
+    }
+
+    // Subscribers pause on their own, the decode keeps running while any of them shows it
+    std::lock_guard<std::mutex> control(session_->control);
+    GStreamerVideo* video = session_->video;
+    if (paused != video->isPaused()) {
+        video->pause();
+    }
+    video->setVolume(volume);
+    video->update(dt);
+}
+
+void SharedVideo::draw()
+{
+    if (session_) {
+        session_->video->drawOn(monitor_);
+    }
+}
+
+void SharedVideo::loopHandler()
+{
+    if (isDriver()) {
+        std::lock_guard<std::mutex> control(session_->control);
+        session_->video->loopHandler();
+    }
+}
+
+void SharedVideo::volumeUpdate()
+{
+    if (isDriver()) {
+        std::lock_guard<std::mutex> control(session_->control);
+        session_->video->volumeUpdate();
+    }
+}
+
+int SharedVideo::getHeight()
+{
+    return session_ ? session_->video->getHeight() : 0;
+}
+
+int SharedVideo::getWidth()
+{
+    return session_ ? session_->video->getWidth() : 0;
+}
+
+void SharedVideo::setVolume(float volume)
+{
+    volume_ = volume;
+}
+
+void SharedVideo::skipForward()
+{
+    if (session_) {
+        std::lock_guard<std::mutex> control(session_->control);
+        session_->video->skipForward();
+    }
+}
+
+void SharedVideo::skipBackward()
+{
+    if (session_) {
+        std::lock_guard<std::mutex> control(session_->control);
+        session_->video->skipBackward();
+    }
+}
+
+void SharedVideo::skipForwardp()
+{
+    if (session_) {
+        std::lock_guard<std::mutex> control(session_->control);
+        session_->video->skipForwardp();
+    }
+}
+
+void SharedVideo::skipBackwardp()
+{
+    if (session_) {
+        std::lock_guard<std::mutex> control(session_->control);
+        session_->video->skipBackwardp();
+    }
+}
+
+void SharedVideo::pause()
+{
+    paused_ = !paused_;
+}
+
+void SharedVideo::restart()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!session_ || session_->subscribers.size() != 1) {
+            return;
+        }
+    }
+    std::lock_guard<std::mutex> control(session_->control);
+    session_->video->restart();
+}
+
+unsigned long long SharedVideo::getCurrent()
+{
+    return session_ ? session_->video->getCurrent() : 0;
+}
+
+unsigned long long SharedVideo::getDuration()
+{
+    return session_ ? session_->video->getDuration() : 0;
+}
+
+bool SharedVideo::isPaused()
+{
+    return paused_;
+}
+
+bool SharedVideo::isPlaying()
+{
+    return session_ && session_->video->isPlaying();
+}
+
+bool SharedVideo::getFrameReady()
+{
+    return session_ && session_->video->getFrameReady();
+}
+
+void SharedVideo::setTargetSize(int width, int height)
+{
+    // The decode only ever grows, so it ends up sized for the largest subscriber
+    if (session_) {
+        session_->video->setTargetSize(width, height);
+    }
+}
+
+void SharedVideo::setPriority(Priority priority)
+{
+    priority_ = priority;
+}
+
+bool SharedVideo::isThrottled()
+{
+    return session_ && session_->throttled;
+}
+
+void SharedVideo::setMaxDecodes(int count)
+{
+    maxDecodes_ = std::max(0, count);
+}
+
+void SharedVideo::govern()
+{
+    size_t cores = std::max(1u, std::thread::hardware_concurrency());
+    size_t limit = maxDecodes_ > 0 ? static_cast<size_t>(maxDecodes_) : cores;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    // Decodes every subscriber paused anyway do not compete
+    std::vector<std::pair<int, Session*>> wanted;
+    for (const auto& session : sessions_) {
+        int priority = PriorityOffscreen;
+        bool paused = true;
+        for (const SharedVideo* subscriber : session->subscribers) {
+            priority = std::max(priority, subscriber->priority_.load());
+            paused = paused && subscriber->paused_;
+        }
+        if (!paused && session->video->isPlaying()) {
+            wanted.emplace_back(priority, session.get());
+        }
+        else {
+            session->throttled = false;
+        }
+    }
+
+    // Selected first, then visible, then offscreen. Among equals the older decode keeps running.
+    std::stable_sort(wanted.begin(), wanted.end(),
+        [](const auto& a, const auto& b) { return a.first > b.first; });
+    for (size_t i = 0; i < wanted.size(); ++i) {
+        wanted[i].second->throttled = i >= limit;
+    }
+
+    size_t running = std::min(wanted.size(), limit);
+    size_t throttled = wanted.size() - running;
+    int threads = static_cast<int>(std::max<size_t>(1, cores / std::max<size_t>(1, running)));
+    if (Configuration::AvdecMaxThreads > 0) {
+        threads = std::min(threads, Configuration::AvdecMaxThreads);
+    }
+    GStreamerVideo::setDecodeThreads(threads);
+
+    if (Benchmark::isActive()) {
+        Benchmark::videoDecodes(static_cast<unsigned int>(running), static_cast<unsigned int>(throttled));
+    }
+    if ((running != lastRunning_ || throttled != lastThrottled_) && Logger::isLevelEnabled("DEBUG")) {
+        LOG_DEBUG("Video", "Decoding " + std::to_string(running) + " videos, " + std::to_string(throttled) +
+            " held back, " + std::to_string(threads) + " decoder threads for the next one to start");
+    }
+    lastRunning_ = running;
+    lastThrottled_ = throttled;
+}
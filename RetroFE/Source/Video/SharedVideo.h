@@ -0,0 +1,106 @@
+/* This file is part of RetroFE.
+ *
+ * RetroFE is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * RetroFE is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with RetroFE.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include "IVideo.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class GStreamerVideo;
+
+// A component's handle on a video decode it may share with others. Components playing
+// the same file with the same loop count subscribe to one GStreamerVideo, so decoding
+// scales with the distinct files on screen rather than with the components showing them.
+// Each handle draws into the decode's texture for its own monitor, and the last one to
+// let go stops the decode.
+class SharedVideo final : public IVideo
+{
+public:
+    SharedVideo(int monitor, int numLoops);
+    SharedVideo(const SharedVideo&) = delete;
+    SharedVideo& operator=(const SharedVideo&) = delete;
+    ~SharedVideo() override;
+    bool initialize() override;
+    bool play(const std::string& file) override;
+    bool stop() override;
+    bool deInitialize() override;
+    SDL_Texture* getTexture() const override;
+    void update(float dt) override;
+    void draw() override;
+    void loopHandler() override;
+    void volumeUpdate() override;
+    int getHeight() override;
+    int getWidth() override;
+    void setVolume(float volume) override;
+    void skipForward() override;
+    void skipBackward() override;
+    void skipForwardp() override;
+    void skipBackwardp() override;
+    // Only pauses the decode once every subscriber has paused it
+    void pause() override;
+    // Only restarts the decode while this handle is its sole subscriber, a shared decode
+    // keeps its place rather than seeking back for everyone showing it
+    void restart() override;
+    unsigned long long getCurrent() override;
+    unsigned long long getDuration() override;
+    bool isPaused() override;
+    bool isPlaying() override;
+    bool getFrameReady() override;
+    void setTargetSize(int width, int height) override;
+    void setPriority(Priority priority) override;
+    bool isThrottled() override;
+
+    // Runs once a frame after the page update. Lets the most important decodes run, up
+    // to the cap, pauses the rest, and splits the cores between those running.
+    static void govern();
+    // Decodes allowed to run at once, 0 for one per core
+    static void setMaxDecodes(int count);
+
+private:
+    // One decode and the handles subscribed to it. The first subscriber drives it: its
+    // update() pulls frames, loops, and applies the loudest volume and the shared pause.
+    struct Session {
+        std::string file;
+        int numLoops;
+        GStreamerVideo* video;
+        std::vector<SharedVideo*> subscribers;
+        // Paused by govern() to make room for more important decodes
+        std::atomic<bool> throttled;
+        // Held while the video is driven or restarted, which may happen on different threads
+        std::mutex control;
+    };
+
+    // Subscribes to a decode of file that is already running, mutex_ must be held
+    bool joinSession(const std::string& file);
+    bool isDriver();
+    void leave();
+
+    int monitor_;
+    int numLoops_;
+    Session* session_{ nullptr };
+    std::atomic<float> volume_{ 0.0f };
+    std::atomic<bool> paused_{ false };
+    std::atomic<int> priority_{ PriorityVisible };
+
+    static std::mutex mutex_;
+    static std::vector<std::unique_ptr<Session>> sessions_;
+    static int maxDecodes_;
+    static size_t lastRunning_;
+    static size_t lastThrottled_;
+};
@@ -18,9 +18,11 @@
 #include "IVideo.h"
 #include "../Utility/Log.h"
 #include "GStreamerVideo.h"
+#include "SharedVideo.h"
 
 bool VideoFactory::enabled_ = true;
 int VideoFactory::numLoops_ = 0;
+int VideoFactory::prerollCount_ = 2;
 IVideo *VideoFactory::instance_ = nullptr;
 
 
@@ -30,13 +32,10 @@ IVideo* VideoFactory::createVideo(int monitor, int numLoops)
         return nullptr; // Early return if not enabled
     }
 
-    auto* instance = new GStreamerVideo(monitor);
-    instance->initialize();
-
     int loopsToSet = (numLoops > 0) ? numLoops : numLoops_;
-    instance->setNumLoops(loopsToSet);
 
-    return instance;
+    // Components playing the same file share its decode
+    return new SharedVideo(monitor, loopsToSet);
 }
 
 
@@ -50,4 +49,57 @@ void VideoFactory::setEnabled(bool enabled)
 void VideoFactory::setNumLoops(int numLoops)
 {
     numLoops_ = numLoops;
+}
+
+
+void VideoFactory::setPoolSize(int size)
+{
+    GStreamerVideo::setPoolSize(size);
+}
+
+
+void VideoFactory::clearPool()
+{
+    GStreamerVideo::clearPool();
+}
+
+
+void VideoFactory::setPrerollCount(int count)
+{
+    prerollCount_ = count;
+    GStreamerVideo::setPrerollCount(count);
+}
+
+
+int VideoFactory::getPrerollCount()
+{
+    return enabled_ ? prerollCount_ : 0;
+}
+
+
+void VideoFactory::preroll(const void *owner, size_t count, std::function<std::string(size_t)> findFile)
+{
+    if (enabled_) {
+        GStreamerVideo::preroll(owner, count, std::move(findFile));
+    }
+}
+
+
+void VideoFactory::releasePrerolled(const void *owner)
+{
+    GStreamerVideo::releasePrerolled(owner);
+}
+
+
+void VideoFactory::setMaxDecodes(int count)
+{
+    SharedVideo::setMaxDecodes(count);
+}
+
+
+void VideoFactory::govern()
+{
+    if (enabled_) {
+        SharedVideo::govern();
+    }
 }
\ No newline at end of file
@@ -15,6 +15,10 @@
  */
 #pragma once
 
+#include <functional>
+#include <string>
+#include <vector>
+
 class IVideo;
 
 class VideoFactory
@@ -23,9 +27,20 @@ public:
     static IVideo *createVideo( int monitor, int numLoops = -1 );
     static void    setEnabled(bool enabled);
     static void    setNumLoops(int numLoops);
+    static void    setPoolSize(int size);
+    static void    clearPool();
+    static void    setPrerollCount(int count);
+    static int     getPrerollCount();
+    // Looks up and prerolls count files on the thread pool, see GStreamerVideo::preroll
+    static void    preroll(const void *owner, size_t count, std::function<std::string(size_t)> findFile);
+    static void    releasePrerolled(const void *owner);
+    static void    setMaxDecodes(int count);
+    // Decides which videos keep decoding, call once a frame after the page update
+    static void    govern();
 
 private:
     static bool    enabled_;
     static int     numLoops_;
+    static int     prerollCount_;
     static IVideo *instance_;
 };
\ No newline at end of file